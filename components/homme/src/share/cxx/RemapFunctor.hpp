@@ -245,6 +245,8 @@ struct Remapper {
   virtual void run_remap(int np1, int np1_qdp, double dt) = 0;
   virtual int requested_buffer_size () const = 0;
   virtual void init_buffers(const FunctorsBuffersManager& fbm) = 0;
+  virtual void set_remap_batch_size (const int batch_size) = 0;
+  virtual int get_remap_batch_size () const = 0;
 };
 
 // The Remap functor
@@ -275,7 +277,14 @@ struct RemapFunctor : public Remapper {
 
   RemapType m_remap;
 
-  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr;
+  // Number of fields (states+tracers) remapped by a single team. All fields
+  // of a column share the same source/target grids, so batching them in one
+  // team reuses the grid data computed in compute_grids_phase while it is
+  // still hot, and saves kernel launches. If one batch covers all the fields
+  // of an element, the grids phase is fused in the same kernel as well.
+  int m_remap_batch;
+
+  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr, m_tu_ne_nb;
 
   explicit
   RemapFunctor (const int qsize,
@@ -292,7 +301,13 @@ struct RemapFunctor : public Remapper {
    , m_tu_ne(remap_team_policy<ComputeThicknessTag>(m_state.num_elems()))
    , m_tu_ne_nsr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_fields_provider.num_states_remap()))
    , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_to_remap()))
+   , m_tu_ne_nb(m_tu_ne_ntr)
   {
+    // On GPU we want as much parallelism as possible, so one field per team.
+    // On CPU, concurrency is limited by the number of threads, so let each
+    // team sweep over all the fields of its element.
+    set_remap_batch_size(OnGpu<ExecSpace>::value ? 1 : num_to_remap());
+
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
     host_valid_input = Kokkos::create_mirror_view(valid_layer_thickness);
@@ -311,6 +326,22 @@ struct RemapFunctor : public Remapper {
   KOKKOS_INLINE_FUNCTION
   int num_to_remap() const { return m_fields_provider.num_states_remap() + m_data.qsize; }
 
+  KOKKOS_INLINE_FUNCTION
+  int num_remap_batches() const {
+    return m_remap_batch>0 ? (num_to_remap() + m_remap_batch - 1) / m_remap_batch : 0;
+  }
+
+  void set_remap_batch_size (const int batch_size) override {
+    // A non-positive value means 'all fields in one batch'
+    const int ntr = num_to_remap();
+    m_remap_batch = (batch_size<=0 || batch_size>ntr) ? ntr : batch_size;
+    if (num_remap_batches()>0) {
+      m_tu_ne_nb = TeamUtils<ExecSpace>(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_remap_batches()));
+    }
+  }
+
+  int get_remap_batch_size () const override { return m_remap_batch; }
+
   KOKKOS_INLINE_FUNCTION
   ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>
   get_remap_val(const KernelVariables &kv, int var) const {
@@ -326,6 +357,10 @@ struct RemapFunctor : public Remapper {
   struct ComputeThicknessTag {};
   struct ComputeGridsTag {};
   struct ComputeRemapTag {};
+  // Remaps a batch of fields, reusing the same grids
+  struct ComputeRemapBatchTag {};
+  // Computes the grids, then remaps all fields of the element
+  struct ComputeGridsAndRemapTag {};
   // Computes the extrinsic values of the states in the initial map
   // i.e. velocity -> momentum
   struct ComputeExtrinsicsTag {};
@@ -387,6 +422,37 @@ struct RemapFunctor : public Remapper {
     this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
   }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(ComputeRemapBatchTag, const TeamMember &team) const {
+    KernelVariables kv(team, m_tu_ne_nb);
+    assert(num_remap_batches() != 0);
+    const int ibatch = kv.ie % num_remap_batches();
+    kv.ie /= num_remap_batches();
+    assert(kv.ie < m_state.num_elems());
+
+    const int vbeg = ibatch*m_remap_batch;
+    const int vend = min(vbeg+m_remap_batch,num_to_remap());
+    for (int var=vbeg; var<vend; ++var) {
+      // Note: compute_remap_phase ends with a team barrier, so the
+      //       per-team scratch buffers can be safely reused by the next var
+      this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(ComputeGridsAndRemapTag, const TeamMember &team) const {
+    KernelVariables kv(team, m_tu_ne_nb);
+    assert(num_remap_batches() == 1);
+    m_remap.compute_grids_phase(
+        kv, m_fields_provider.get_source_thickness(kv.ie, m_data.np1),
+        Homme::subview(m_fields_provider.m_tgt_layer_thickness, kv.ie));
+    kv.team_barrier();
+
+    for (int var=0; var<num_to_remap(); ++var) {
+      this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    }
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(ComputeIntrinsicsTag, const TeamMember &team) const {
     KernelVariables kv(team, m_tu_ne_nsr);
@@ -437,10 +503,20 @@ struct RemapFunctor : public Remapper {
         run_functor<ComputeExtrinsicsTag>("Remap Scale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
       }
-      run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
-                                   m_state.num_elems());
-      run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+      if (num_remap_batches()==1) {
+        run_functor<ComputeGridsAndRemapTag>("Remap Compute Grids And Remap Functor",
+                                             m_state.num_elems());
+      } else {
+        run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
+                                     m_state.num_elems());
+        if (m_remap_batch==1) {
+          run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
+                                       m_state.num_elems() * num_to_remap());
+        } else {
+          run_functor<ComputeRemapBatchTag>("Remap Compute Remap Batch Functor",
+                                            m_state.num_elems() * num_remap_batches());
+        }
+      }
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
@@ -172,7 +172,8 @@ namespace Remap {
 // compute_remap_phase remaps each of the tracers based on the quantities
 // previously computed in compute_grids_phase.
 // It is also expected to have a large amount of parallelism, specifically
-// qsize * num_elems
+// qsize * num_elems. Since all fields of an element share the same grids,
+// the caller may also remap several fields in sequence within the same team.
 struct VertRemapAlg {};
 } // namespace Remap
 
@@ -133,6 +133,20 @@ void VerticalRemapManager::run_remap(int np1, int np1_qdp, double dt) const {
   p_->remapper->run_remap(np1, np1_qdp, dt);
 }
 
+void VerticalRemapManager::set_remap_batch_size (const int batch_size) {
+  assert(is_setup);
+  assert(p_);
+  assert(p_->remapper);
+  p_->remapper->set_remap_batch_size(batch_size);
+}
+
+int VerticalRemapManager::get_remap_batch_size () const {
+  assert(is_setup);
+  assert(p_);
+  assert(p_->remapper);
+  return p_->remapper->get_remap_batch_size();
+}
+
 struct TempTagStruct  {};
 
 int VerticalRemapManager::requested_buffer_size () const {
@@ -20,6 +20,11 @@ struct VerticalRemapManager {
 
   void run_remap(int np1, int np1_qdp, double dt) const;
 
+  // Number of fields remapped by each team during the remap phase.
+  // A non-positive value means all fields of an element in one team.
+  void set_remap_batch_size (const int batch_size);
+  int get_remap_batch_size () const;
+
   int requested_buffer_size () const;
   void init_buffers(const FunctorsBuffersManager& fbm);
 
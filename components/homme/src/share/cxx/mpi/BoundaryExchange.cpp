@@ -1205,8 +1205,9 @@ void BoundaryExchange::build_buffer_views_and_requests()
     free_requests();
     m_send_requests.resize(npids);
     m_recv_requests.resize(npids);
-    MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
-    MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
+    // Note: these may be device pointers, even if MPIMemSpace!=ExecMemSpace
+    Real* send_ptr = buffers_manager->get_mpi_send_data();
+    Real* recv_ptr = buffers_manager->get_mpi_recv_data();
     int offset = 0;
     for (int ip = 0; ip < npids; ++ip) {
       int count = 0;
@@ -9,15 +9,31 @@
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
 
+#include <cstdlib>
+#include <cstring>
+
 namespace Homme
 {
 
+namespace {
+// If MPI buffers are on device at compile time, there's nothing to choose.
+// Otherwise, the user can ask for MPI on device buffers at runtime.
+bool default_mpi_on_device () {
+  if (std::is_same<MPIMemSpace,ExecMemSpace>::value) {
+    return true;
+  }
+  const char* env = std::getenv("HOMMEXX_MPI_ON_DEVICE");
+  return env!=nullptr && std::strcmp(env,"1")==0;
+}
+} // anonymous namespace
+
 MpiBuffersManager::MpiBuffersManager ()
  : m_num_customers     (0)
  , m_mpi_buffer_size   (0)
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_mpi_on_device     (default_mpi_on_device())
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -80,9 +96,15 @@ void MpiBuffersManager::allocate_buffers ()
   m_recv_buffer  = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
   m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
 
-  // The buffers used in MPI calls
-  m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
-  m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
+  // The buffers used in MPI calls. If MPI uses the send/recv buffers directly,
+  // don't waste memory on host mirrors (unless they alias the buffers anyways)
+  if (m_mpi_on_device && !std::is_same<MPIMemSpace,ExecMemSpace>::value) {
+    m_mpi_send_buffer = decltype(m_mpi_send_buffer)();
+    m_mpi_recv_buffer = decltype(m_mpi_recv_buffer)();
+  } else {
+    m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
+    m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
+  }
 
   m_views_are_valid = true;
 
@@ -93,6 +115,25 @@ void MpiBuffersManager::allocate_buffers ()
   }
 }
 
+void MpiBuffersManager::set_mpi_on_device (const bool mpi_on_device)
+{
+  // Can't switch while an exchange is ongoing
+  assert (!m_buffers_busy);
+
+  // If MPIMemSpace=ExecMemSpace, the mpi buffers *are* the send/recv buffers
+  const bool value = mpi_on_device || std::is_same<MPIMemSpace,ExecMemSpace>::value;
+  if (value!=m_mpi_on_device) {
+    m_mpi_on_device = value;
+
+    // If buffers were already allocated, reallocate them right away, so that
+    // the customers rebuild their requests on the new mpi buffers
+    if (m_views_are_valid) {
+      m_views_are_valid = false;
+      allocate_buffers();
+    }
+  }
+}
+
 void MpiBuffersManager::lock_buffers ()
 {
   // Make sure we are not trying to lock buffers already locked
@@ -70,6 +70,14 @@ class BoundaryExchange;
  * which is a no-op if the MPIMemSpace=ExecMemSpace, that is, if
  * the MPI is performed using pointers on the Execution Space.
  *
+ * If MPIMemSpace!=ExecMemSpace (GPU build with HOMMEXX_MPI_ON_DEVICE=0),
+ * the use of device pointers in MPI calls can still be enabled at runtime,
+ * either via set_mpi_on_device, or by setting the env var
+ * HOMMEXX_MPI_ON_DEVICE=1 (the MPI library must be GPU-aware). In that
+ * case, the host mirrors are not allocated, the persistent requests of
+ * the customers are built on the send/recv buffers, and the sync methods
+ * are no-ops. Otherwise, MPI is staged through host memory, as usual.
+ *
  */
 
 class MpiBuffersManager
@@ -106,6 +114,12 @@ public:
   bool are_buffers_busy () const { return m_buffers_busy; }
   bool are_views_valid () const { return m_views_are_valid; }
 
+  // Whether MPI calls use the send/recv buffers directly (no host staging).
+  // Note: if buffers were already allocated, this reallocates them, and forces
+  //       all customers to rebuild their buffer views and requests.
+  void set_mpi_on_device (const bool mpi_on_device);
+  bool is_mpi_on_device () const { return m_mpi_on_device; }
+
   ExecViewUnmanaged<Real*> get_send_buffer           () const;
   ExecViewUnmanaged<Real*> get_recv_buffer           () const;
   ExecViewUnmanaged<Real*> get_local_buffer          () const;
@@ -114,6 +128,10 @@ public:
   ExecViewUnmanaged<Real*> get_blackhole_send_buffer () const;
   ExecViewUnmanaged<Real*> get_blackhole_recv_buffer () const;
 
+  // The pointers to be used in MPI calls (depend on is_mpi_on_device())
+  Real* get_mpi_send_data () const;
+  Real* get_mpi_recv_data () const;
+
   std::shared_ptr<Connectivity> get_connectivity () const { return m_connectivity; }
 
 private:
@@ -163,6 +181,9 @@ private:
   // Used to check whether user can still request different sizes
   bool m_views_are_valid;
 
+  // Whether MPI is done directly on the send/recv buffers
+  bool m_mpi_on_device;
+
   // Customers of this MpiBuffersManager, each with its local and mpi sizes
   std::map<BoundaryExchange*,CustomerNeeds>  m_customers;
 
@@ -188,6 +209,11 @@ inline void MpiBuffersManager::sync_send_buffer (BoundaryExchange* customer)
   // Only customers can call this
   assert (m_customers.find(customer)!=m_customers.end());
 
+  // MPI reads directly from the send buffer
+  if (m_mpi_on_device) {
+    return;
+  }
+
   const size_t customer_mpi_buffer_size = m_customers.find(customer)->second.mpi_buffer_size;
   if (customer_mpi_buffer_size<m_mpi_buffer_size) {
     // Avoid copying more than we need
@@ -204,6 +230,11 @@ inline void MpiBuffersManager::sync_recv_buffer (BoundaryExchange* customer)
   // Only customers can call this
   assert (m_customers.find(customer)!=m_customers.end());
 
+  // MPI writes directly into the recv buffer
+  if (m_mpi_on_device) {
+    return;
+  }
+
   const size_t customer_mpi_buffer_size = m_customers.find(customer)->second.mpi_buffer_size;
   if (customer_mpi_buffer_size<m_mpi_buffer_size) {
     // Avoid copying more than we need
@@ -255,6 +286,22 @@ MpiBuffersManager::get_mpi_recv_buffer() const
   return m_mpi_recv_buffer;
 }
 
+inline Real*
+MpiBuffersManager::get_mpi_send_data() const
+{
+  // We ensure that the buffers are valid
+  assert(m_views_are_valid);
+  return m_mpi_on_device ? m_send_buffer.data() : m_mpi_send_buffer.data();
+}
+
+inline Real*
+MpiBuffersManager::get_mpi_recv_data() const
+{
+  // We ensure that the buffers are valid
+  assert(m_views_are_valid);
+  return m_mpi_on_device ? m_recv_buffer.data() : m_mpi_recv_buffer.data();
+}
+
 inline ExecViewUnmanaged<Real*>
 MpiBuffersManager::get_blackhole_send_buffer () const
 {
@@ -294,6 +341,11 @@ public:
     return m_bmm.at(MPI_EXCHANGE)->is_connectivity_set();
   }
 
+  void set_mpi_on_device (const bool mpi_on_device) {
+    m_bmm[MPI_EXCHANGE]->set_mpi_on_device(mpi_on_device);
+    m_bmm[MPI_EXCHANGE_MIN_MAX]->set_mpi_on_device(mpi_on_device);
+  }
+
   std::shared_ptr<MpiBuffersManager> operator() (int exchange_type) const {
     return m_bmm.at(exchange_type);
   }
@@ -8,6 +8,7 @@
 #include "utilities/TestUtils.hpp"
 
 #include <random>
+#include <vector>
 
 TEST_CASE("remap_interface", "vertical remap") {
 
@@ -79,4 +80,43 @@ TEST_CASE("remap_interface", "vertical remap") {
     RF remap(qsize, elements, tracers, hvcoord);
     REQUIRE_NOTHROW(remap.run_remap(np1, n0_qdp, dt));
   }
+  SECTION("tracer_batches") {
+    // Remapping fields one per team, in batches, or all in one team
+    // (fused with the grids computation) must give BFB identical results.
+    constexpr bool rsplit_non_zero = false;
+    constexpr int qsize = QSIZE_D;
+    using RF = RemapFunctor<rsplit_non_zero, PpmVertRemap<PpmMirrored>>;
+
+    const int batch_sizes[3] = {1, 3, qsize};
+    std::vector<decltype(Kokkos::create_mirror_view(tracers.qdp))> results;
+    for (const int bs : batch_sizes) {
+      Elements elems;
+      elems.init(num_elems,seed, /*alloc_gradphis = */ false);
+      elems.randomize(seed);
+
+      Tracers tr;
+      tr.init(num_elems,QSIZE_D);
+      tr.randomize(seed+1);
+
+      RF remap(qsize, elems, tr, hvcoord);
+      remap.set_remap_batch_size(bs);
+      REQUIRE (remap.get_remap_batch_size()==std::min(bs,qsize));
+      REQUIRE_NOTHROW(remap.run_remap(np1, n0_qdp, dt));
+
+      results.push_back(Kokkos::create_mirror_view(tr.qdp));
+      Kokkos::deep_copy(results.back(),tr.qdp);
+    }
+
+    const Real* ref = reinterpret_cast<const Real*>(results[0].data());
+    const int size = results[0].size()*VECTOR_SIZE;
+    for (size_t ir=1; ir<results.size(); ++ir) {
+      const Real* res = reinterpret_cast<const Real*>(results[ir].data());
+      for (int i=0; i<size; ++i) {
+        REQUIRE (std::isnan(ref[i])==std::isnan(res[i]));
+        if (!std::isnan(ref[i])) {
+          REQUIRE (ref[i]==res[i]);
+        }
+      }
+    }
+  }
 }
@@ -0,0 +1,162 @@
+#include <catch2/catch.hpp>
+
+#include "Context.hpp"
+#include "mpi/MpiBuffersManager.hpp"
+#include "mpi/BoundaryExchange.hpp"
+#include "mpi/Connectivity.hpp"
+#include "utilities/TestUtils.hpp"
+#include "Types.hpp"
+
+#include <random>
+#include <iomanip>
+#include <tuple>
+
+using namespace Homme;
+
+extern "C" {
+
+void initmp_f90 ();
+void init_cube_geometry_f90 (const int& ne);
+void init_connectivity_f90 ();
+void cleanup_geometry_f90 ();
+
+} // extern "C"
+
+namespace {
+
+// Require bitwise identical values (including the padding of the last pack)
+template<typename ViewT>
+void require_same (const ViewT& expected, const ViewT& computed) {
+  REQUIRE (expected.size()==computed.size());
+  const auto e = expected.data();
+  const auto c = computed.data();
+  for (size_t i=0; i<expected.size(); ++i) {
+    for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+      if (e[i][iv]!=c[i][iv]) {
+        std::cout << std::setprecision(17) << expected.label() << ", i,iv: " << i << ", " << iv << "\n";
+        std::cout << std::setprecision(17) << "expected: " << e[i][iv] << "\n";
+        std::cout << std::setprecision(17) << "computed: " << c[i][iv] << "\n";
+      }
+      REQUIRE (e[i][iv]==c[i][iv]);
+    }
+  }
+}
+
+template<typename ViewT>
+void require_same_real (const ViewT& expected, const ViewT& computed) {
+  REQUIRE (expected.size()==computed.size());
+  const auto e = expected.data();
+  const auto c = computed.data();
+  for (size_t i=0; i<expected.size(); ++i) {
+    if (e[i]!=c[i]) {
+      std::cout << std::setprecision(17) << expected.label() << ", i: " << i << "\n";
+      std::cout << std::setprecision(17) << "expected: " << e[i] << "\n";
+      std::cout << std::setprecision(17) << "computed: " << c[i] << "\n";
+    }
+    REQUIRE (e[i]==c[i]);
+  }
+}
+
+} // anonymous namespace
+
+// =========================== TESTS ============================ //
+
+TEST_CASE ("Boundary Exchange MPI on device", "Host-staged and device-direct MPI give the same exchange")
+{
+  std::random_device rd;
+  using rngAlg = std::mt19937_64;
+  const unsigned int catchRngSeed = Catch::rngSeed();
+  const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+  std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+  rngAlg engine(seed);
+  std::uniform_real_distribution<Real> dreal(0.0, 1.0);
+
+  constexpr int ne = 2;
+  constexpr int num_min_max_fields_1d = 1;
+  constexpr int field_2d_idim = 0;
+  constexpr int field_3d_idim = 1;
+
+  // If MPI buffers are on device at compile time, host staging can't be selected at runtime
+  constexpr bool always_on_device = std::is_same<MPIMemSpace,ExecMemSpace>::value;
+
+  // Initialize f90 mpi stuff, geometry, and connectivity
+  initmp_f90();
+  init_cube_geometry_f90(ne);
+  init_connectivity_f90();
+
+  // Note: init_connectivity_f90 calls init_connectivity, which in turns creates
+  //       a Connectivity object in the Context, making the following call safe.
+  std::shared_ptr<Connectivity> connectivity = Context::singleton().get_ptr<Connectivity>();
+  const int num_elements = connectivity->get_num_local_elements();
+
+  // Input fields (never exchanged), and fields to exchange
+  ExecViewManaged<Real*[NUM_TIME_LEVELS][NP][NP]>                  field_2d_in ("field_2d", num_elements);
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]>       field_3d_in ("field_3d", num_elements);
+  ExecViewManaged<Scalar*[num_min_max_fields_1d][2][NUM_LEV]>      field_1d_in ("field_1d", num_elements);
+  ExecViewManaged<Real*[NUM_TIME_LEVELS][NP][NP]>                  field_2d ("field_2d", num_elements);
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]>       field_3d ("field_3d", num_elements);
+  ExecViewManaged<Scalar*[num_min_max_fields_1d][2][NUM_LEV]>      field_1d ("field_1d", num_elements);
+  genRandArray(field_2d_in,engine,dreal);
+  genRandArray(field_3d_in,engine,dreal);
+  genRandArray(field_1d_in,engine,dreal);
+
+  // Get the buffers managers
+  auto& bmm = Context::singleton().create<MpiBuffersManagerMap>();
+  std::shared_ptr<MpiBuffersManager> buffers_manager = bmm[MPI_EXCHANGE];
+  std::shared_ptr<MpiBuffersManager> buffers_manager_min_max = bmm[MPI_EXCHANGE_MIN_MAX];
+
+  // Create and setup the boundary exchanges
+  std::shared_ptr<BoundaryExchange> be = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+  std::shared_ptr<BoundaryExchange> be_min_max = std::make_shared<BoundaryExchange>(connectivity,buffers_manager_min_max);
+
+  be->set_num_fields(0,1,1);
+  be->register_field(field_2d,1,field_2d_idim);
+  be->register_field(field_3d,1,field_3d_idim);
+  be->registration_completed();
+
+  be_min_max->set_num_fields(num_min_max_fields_1d,0,0);
+  be_min_max->register_min_max_fields(field_1d,num_min_max_fields_1d,0);
+  be_min_max->registration_completed();
+
+  // Run the same exchange on the same inputs, and return the results on host.
+  // Switching the MPI buffers reallocates them, so the requests get rebuilt.
+  auto run_exchange = [&] (const bool mpi_on_device) {
+    bmm.set_mpi_on_device(mpi_on_device);
+    REQUIRE (buffers_manager->is_mpi_on_device()==(mpi_on_device || always_on_device));
+    REQUIRE (buffers_manager_min_max->is_mpi_on_device()==(mpi_on_device || always_on_device));
+
+    Kokkos::deep_copy(field_2d,field_2d_in);
+    Kokkos::deep_copy(field_3d,field_3d_in);
+    Kokkos::deep_copy(field_1d,field_1d_in);
+
+    be->exchange();
+    be_min_max->exchange_min_max();
+
+    // Note: create_mirror (not create_mirror_view), so that results of different runs don't alias
+    auto field_2d_h = Kokkos::create_mirror(field_2d);
+    auto field_3d_h = Kokkos::create_mirror(field_3d);
+    auto field_1d_h = Kokkos::create_mirror(field_1d);
+    Kokkos::deep_copy(field_2d_h,field_2d);
+    Kokkos::deep_copy(field_3d_h,field_3d);
+    Kokkos::deep_copy(field_1d_h,field_1d);
+    return std::make_tuple(field_2d_h,field_3d_h,field_1d_h);
+  };
+
+  // Host-staged, then device-direct, then host-staged again (to check switching back)
+  const auto staged = run_exchange(false);
+  const auto direct = run_exchange(true);
+  const auto staged_again = run_exchange(false);
+
+  require_same_real(std::get<0>(staged),std::get<0>(direct));
+  require_same(std::get<1>(staged),std::get<1>(direct));
+  require_same(std::get<2>(staged),std::get<2>(direct));
+
+  require_same_real(std::get<0>(staged),std::get<0>(staged_again));
+  require_same(std::get<1>(staged),std::get<1>(staged_again));
+  require_same(std::get<2>(staged),std::get<2>(staged_again));
+
+  // Cleanup
+  be->clean_up();
+  be_min_max->clean_up();
+  cleanup_geometry_f90();
+}
@@ -1,6 +1,24 @@
 from utils import run_cmd_no_fail, run_cmd, expect, median
 
-import os, tempfile, re
+import os, tempfile, re, json, csv, statistics
+from collections import OrderedDict
+
+###############################################################################
+def get_stats(times):
+###############################################################################
+    """
+    >>> stats = get_stats([3.0, 1.0, 2.0])
+    >>> stats["min"], stats["median"], stats["mean"], stats["max"], stats["stddev"]
+    (1.0, 2.0, 2.0, 3.0, 1.0)
+    >>> get_stats([1.0])["stddev"]
+    0.0
+    """
+    return {"runs"   : len(times),
+            "min"    : min(times),
+            "median" : median(times),
+            "mean"   : statistics.mean(times),
+            "max"    : max(times),
+            "stddev" : statistics.stdev(times) if len(times) > 1 else 0.0}
 
 ###############################################################################
 class ScalingExp(object):
@@ -69,11 +87,12 @@ class PerfAnalysis(object):
 ###############################################################################
 
     ###########################################################################
-    def __init__(self, argmap, force_threads, num_runs, tests, cmake_options, use_existing, scaling_exp, plot_friendly, machine, scream_docs, verbose, cd):
+    def __init__(self, argmap, force_threads, num_runs, warmup, tests, cmake_options, use_existing, scaling_exp, plot_friendly, machine, scream_docs, verbose, cd, output):
     ###########################################################################
         self._argmap        = argmap
         self._force_threads = force_threads
         self._num_runs      = num_runs
+        self._warmup        = warmup
         self._tests         = tests
         self._cmake_options = cmake_options
         self._use_existing  = use_existing
@@ -83,6 +102,14 @@ class PerfAnalysis(object):
         self._scream_docs   = scream_docs
         self._verbose       = verbose
         self._cd            = cd
+        self._output        = output
+        self._records       = []
+
+        expect(output is None or os.path.splitext(output)[1] in [".json", ".csv"],
+               "Output file '{}' must have extension .json or .csv".format(output))
+        if output is not None:
+            # We chdir into the build dir later, so store the absolute path
+            self._output = os.path.abspath(output)
 
     ###############################################################################
     def build(self):
@@ -120,8 +147,35 @@ class PerfAnalysis(object):
                 expect(the_time is None, "Multiple matches!")
                 the_time = float(m.groups()[0])
 
+        if the_time is None:
+            # Tests driven by the AD do not print a total time, but report the
+            # time of each atm process. The first one is the top-level group.
+            proc_timings = self.get_proc_timings(output)
+            if proc_timings:
+                the_time = list(proc_timings.values())[0]["total"]
+
+        expect(the_time is not None, "Could not find a time in the test output")
         return the_time
 
+    ###############################################################################
+    @staticmethod
+    def get_proc_timings(output):
+    ###############################################################################
+        r"""
+        >>> output = 'Foo\nTiming: P3 calls=3 first=1.0e+00 total=2.0e+00 min=9.0e-01 max=1.1e+00 avg=1.0e+00 seconds\nbar'
+        >>> PerfAnalysis.get_proc_timings(output)
+        {'P3': {'calls': 3.0, 'first': 1.0, 'total': 2.0, 'min': 0.9, 'max': 1.1, 'avg': 1.0}}
+        """
+        regex = re.compile(r'Timing:\s+(\S+)\s+(.*)\s+seconds')
+        timings = {}
+        for line in output.splitlines():
+            m = regex.match(line)
+            if m:
+                name, items = m.groups()
+                timings[name] = {key : float(val) for key, val in [item.split("=") for item in items.split()]}
+
+        return timings
+
     ###############################################################################
     def get_threads(self, output):
     ###############################################################################
@@ -176,25 +230,88 @@ class PerfAnalysis(object):
         with open("{}.perf.log".format(os.path.split(test_exe)[1].split(" ")[0]), "w") as fd:
             fd.write(cmd + "\n\n")
             fd.write("ENV: \n{}\n\n".format(run_cmd_no_fail("env")))
+            for _ in range(self._warmup):
+                output = run_cmd_no_fail(cmd, from_dir=test_path, verbose=self._verbose)
+                fd.write("WARMUP RUN (discarded):\n" + output + "\n\n")
+
+            proc_results = {}
             for _ in range(self._num_runs):
                 output = run_cmd_no_fail(cmd, from_dir=test_path, verbose=(not self._plot_friendly or self._verbose))
                 fd.write(output + "\n\n")
                 results.append(self.get_time(output))
+                for name, timing in self.get_proc_timings(output).items():
+                    proc_results.setdefault(name, []).append(timing["total"])
 
             threads = self.get_threads(output)
 
-        return median(results), threads
+        proc_stats = {name : get_stats(times) for name, times in proc_results.items()}
+        return get_stats(results), proc_stats, threads
 
     ###############################################################################
-    def user_explain(self, test, cols, med_time, reference, threads):
+    def user_explain(self, test, cols, stats, proc_stats, reference, threads):
     ###############################################################################
+        med_time = stats["median"]
         msg = "{} ran in {} seconds with {} threads, {:.2f} cols/sec".format(test, med_time, threads, float(cols)/med_time)
         if reference:
             speedup = (1.0 - (med_time / reference)) * 100
             msg += ", speedup={:.2f}%".format(speedup)
 
+        if stats["runs"] > 1:
+            msg += "\n  over {} runs: min={:.3e} mean={:.3e} max={:.3e} stddev={:.3e}".\
+                   format(stats["runs"], stats["min"], stats["mean"], stats["max"], stats["stddev"])
+
+        for name, pstats in proc_stats.items():
+            msg += "\n  {}: median={:.3e} min={:.3e} max={:.3e} seconds".\
+                   format(name, pstats["median"], pstats["min"], pstats["max"])
+
         print(msg)
 
+    ###############################################################################
+    def add_record(self, test, stats, proc_stats, threads):
+    ###############################################################################
+        st, out, _ = run_cmd("git rev-parse --short HEAD")
+        record = OrderedDict()
+        record["test"]    = test
+        record["machine"] = self._machine
+        record["commit"]  = out if st == 0 else "Unknown"
+        record["threads"] = threads
+        for name, val in zip(self._argmap.keys(), self._scaling_exp.values(incl_threads=False)):
+            record[name] = val
+
+        for key, val in stats.items():
+            record[key] = val
+
+        record["cols_per_sec"] = float(self._scaling_exp.values()[0]) / stats["median"]
+        record["processes"] = proc_stats
+        self._records.append(record)
+
+    ###############################################################################
+    def write_records(self):
+    ###############################################################################
+        if self._output.endswith(".json"):
+            with open(self._output, "w") as fd:
+                json.dump(self._records, fd, indent=2)
+        else:
+            # CSV is flat: one column per process median time
+            rows = []
+            for record in self._records:
+                row = OrderedDict((key, val) for key, val in record.items() if key != "processes")
+                for name, pstats in record["processes"].items():
+                    row["{}_median".format(name)] = pstats["median"]
+                rows.append(row)
+
+            fieldnames = []
+            for row in rows:
+                fieldnames += [key for key in row.keys() if key not in fieldnames]
+
+            with open(self._output, "w", newline="") as fd:
+                writer = csv.DictWriter(fd, fieldnames=fieldnames)
+                writer.writeheader()
+                writer.writerows(rows)
+
+        if not self._plot_friendly:
+            print("Results written to {}".format(self._output))
+
     ###############################################################################
     def perf_analysis(self):
     ###############################################################################
@@ -222,13 +339,17 @@ class PerfAnalysis(object):
 
             reference = None
             for test, test_cmd in self._tests.items():
-                med_time, threads = self.run_test(test_cmd)
+                stats, proc_stats, threads = self.run_test(test_cmd)
+                med_time = stats["median"]
                 self._scaling_exp.threads = threads
 
                 if self._plot_friendly:
                     results.setdefault(test, []).append((self._scaling_exp.values()[0], med_time, self._scaling_exp.get_scaling_var()))
                 else:
-                    self.user_explain(test, self._scaling_exp.values()[0], med_time, reference, threads)
+                    self.user_explain(test, self._scaling_exp.values()[0], stats, proc_stats, reference, threads)
+
+                if self._output is not None:
+                    self.add_record(test, stats, proc_stats, threads)
 
                 reference = med_time if reference is None else reference
 
@@ -237,6 +358,9 @@ class PerfAnalysis(object):
         if self._plot_friendly:
             self._scaling_exp.plot(results)
 
+        if self._output is not None:
+            self.write_records()
+
         return True
 
     ###############################################################################
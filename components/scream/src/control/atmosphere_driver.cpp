@@ -2,11 +2,16 @@
 
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
+#include "share/atm_process/conservation_check.hpp"
 #include "share/field/field_utils.hpp"
 
 #include "ekat/ekat_assert.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+
 namespace scream {
 
 namespace control {
@@ -267,8 +272,14 @@ initialize_fields (const util::TimeStamp& t0)
   const auto& ref_grid_name = m_grids_manager->get_reference_grid()->name();
 
   // Create parameter list for AtmosphereInput
+  // Note: in ensemble runs, all members read the same initial conditions.
   ekat::ParameterList ic_reader_params;
   ic_reader_params.set("GRID",ref_grid_name);
+  ic_reader_params.set("ENSEMBLE INPUT",true);
+
+  // In ensemble runs, some fields can be given a different constant value for each member,
+  // e.g., to run a perturbed-parameter ensemble, via "Ensemble Member Values: {fname: [val0,...,valN]}".
+  const bool has_ens_values = ic_pl.isSublist("Ensemble Member Values");
   auto& ic_fields = ic_reader_params.sublist("FIELDS");
   int ifield=0;
   std::vector<FieldIdentifier> ic_fields_to_copy;
@@ -279,7 +290,9 @@ initialize_fields (const util::TimeStamp& t0)
 
     auto f = fm->get_field(fid);
     // First, check if the input file contains constant values for some of the fields
-    if (ic_pl.isParameter(name)) {
+    if (has_ens_values and ic_pl.sublist("Ensemble Member Values").isParameter(name)) {
+      initialize_ensemble_field(req, ic_pl.sublist("Ensemble Member Values"));
+    } else if (ic_pl.isParameter(name)) {
       // The user provided a constant value for this field. Simply use that.
       if (ic_pl.isType<double>(name) or ic_pl.isType<std::vector<double>>(name)) {
         initialize_constant_field(req, ic_pl);
@@ -403,6 +416,54 @@ void AtmosphereDriver::initialize_constant_field(const FieldRequest& freq, const
   }
 }
 
+void AtmosphereDriver::initialize_ensemble_field(const FieldRequest& freq, const ekat::ParameterList& ens_pl)
+{
+  using namespace ShortFieldTagsNames;
+
+  const auto& name = freq.fid.name();
+  const auto& grid_name = freq.fid.get_grid_name();
+  const auto grid = m_grids_manager->get_grid(grid_name);
+  auto f = get_field_mgr(grid_name)->get_field(name);
+  const auto& layout = f.get_header().get_identifier().get_layout();
+
+  // The yaml parser stores a list of integers as ints.
+  std::vector<double> values;
+  if (ens_pl.isType<std::vector<int>>(name)) {
+    for (auto v : ens_pl.get<std::vector<int>>(name)) { values.push_back(v); }
+  } else {
+    values = ens_pl.get<std::vector<double>>(name);
+  }
+
+  const int num_members = grid->get_num_ensemble_members();
+  EKAT_REQUIRE_MSG (values.size()==static_cast<size_t>(num_members),
+      "Error! Ensemble member values array for '" + name + "' has the wrong dimension.\n"
+      "       Number of members: " + std::to_string(num_members) + "\n"
+      "       Array dimension:   " + std::to_string(values.size()) + "\n");
+  EKAT_REQUIRE_MSG (layout.rank()>0 && layout.tag(0)==COL,
+      "Error! Ensemble member values are only supported for fields defined over columns.\n"
+      "       Field: " + name + "\n");
+
+  if (num_members==1) {
+    f.deep_copy(values[0]);
+    return;
+  }
+
+  // Set each column to the value of its member. This is only done once, so do it on host.
+  const auto& member = grid->get_geometry_data("ensemble_member");
+  auto member_h = Kokkos::create_mirror_view(member);
+  Kokkos::deep_copy(member_h,member);
+  auto f_h = f.get_view<Host>();
+  const int ncols = layout.dim(0);
+  const int col_size = f_h.size() / ncols;
+  for (int icol=0; icol<ncols; ++icol) {
+    const double value = values[static_cast<int>(member_h(icol))];
+    for (int i=0; i<col_size; ++i) {
+      f_h(icol*col_size+i) = value;
+    }
+  }
+  f.sync_to_dev();
+}
+
 void AtmosphereDriver::initialize_atm_procs ()
 {
   // Set all the fields in the processes needing them (before, they only had ids)
@@ -438,6 +499,16 @@ void AtmosphereDriver::initialize_atm_procs ()
   // Initialize the processes
   m_atm_process_group->initialize(m_current_ts);
 
+  // Time the runs of the processes only if they are reported, since timing requires a fence after each run
+  m_atm_process_group->set_time_runs(m_atm_params.get<bool>("Report Timings",false));
+
+  // Set up the (optional) budgets of the processes, on the reference grid
+  if (m_atm_params.isSublist("Conservation Check")) {
+    m_conservation_check = std::make_shared<ConservationCheck>(m_atm_comm,get_ref_grid_field_mgr(),
+                                                               m_atm_params.sublist("Conservation Check"));
+    m_atm_process_group->set_conservation_check(m_conservation_check);
+  }
+
   m_ad_status |= s_procs_inited;
 }
 
@@ -470,10 +541,19 @@ void AtmosphereDriver::run (const Real dt) {
     m_surface_coupling->do_import();
   }
 
+  // The budgets of the processes are relative to the state after the import.
+  if (m_conservation_check) {
+    m_conservation_check->begin_step();
+  }
+
   // The class AtmosphereProcessGroup will take care of dispatching arguments to
   // the individual processes, which will be called in the correct order.
   m_atm_process_group->run(dt);
 
+  if (m_conservation_check) {
+    m_conservation_check->end_step();
+  }
+
   // Update current time stamps
   m_current_ts += dt;
 
@@ -487,6 +567,10 @@ void AtmosphereDriver::run (const Real dt) {
 }
 
 void AtmosphereDriver::finalize ( /* inputs? */ ) {
+  if (m_atm_params.get<bool>("Report Timings",false)) {
+    report_timings();
+  }
+
   m_atm_process_group->finalize( /* inputs ? */ );
 
   // Finalize output streams, make sure files are closed
@@ -501,6 +585,42 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
   }
 }
 
+void AtmosphereDriver::report_timings () const {
+  // Gather all atm procs, recursing into groups
+  std::vector<std::shared_ptr<const AtmosphereProcess>> procs;
+  std::function<void(const std::shared_ptr<const AtmosphereProcess>&)> gather;
+  gather = [&](const std::shared_ptr<const AtmosphereProcess>& ap) {
+    procs.push_back(ap);
+    if (ap->type()==AtmosphereProcessType::Group) {
+      auto group = std::dynamic_pointer_cast<const AtmosphereProcessGroup>(ap);
+      for (int i=0; i<group->get_num_processes(); ++i) {
+        gather(group->get_process(i));
+      }
+    }
+  };
+  gather(m_atm_process_group);
+
+  for (const auto& ap : procs) {
+    const auto& timings = ap->get_run_timings();
+    // Since all ranks wait for the slowest one, use the max over ranks.
+    // The min time is reduced with a max as well, so that it is the
+    // fastest step of the slowest rank.
+    double vals[4] = {timings.first_time, timings.total_time, timings.min_time, timings.max_time};
+    MPI_Allreduce(MPI_IN_PLACE, vals, 4, MPI_DOUBLE, MPI_MAX, m_atm_comm.mpi_comm());
+
+    if (m_atm_comm.am_i_root()) {
+      // Avoid spaces in the name, so the line is easy to parse
+      auto name = ap->name();
+      std::replace(name.begin(),name.end(),' ','_');
+
+      const int nsteps = timings.num_calls-1;
+      std::printf("Timing: %s calls=%d first=%1.6e total=%1.6e min=%1.6e max=%1.6e avg=%1.6e seconds\n",
+                  name.c_str(), timings.num_calls, vals[0], vals[1],
+                  nsteps>0 ? vals[2] : 0.0, vals[3], nsteps>0 ? vals[1]/nsteps : 0.0);
+    }
+  }
+}
+
 AtmosphereDriver::field_mgr_ptr
 AtmosphereDriver::get_ref_grid_field_mgr () const {
   EKAT_REQUIRE_MSG (m_ad_status & s_grids_created,
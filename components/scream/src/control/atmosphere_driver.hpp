@@ -21,6 +21,7 @@ namespace scream {
 // Forward declarations
 class AtmosphereProcess;
 class AtmosphereProcessGroup;
+class ConservationCheck;
 
 namespace control {
 
@@ -110,12 +111,21 @@ public:
 protected:
 
   void initialize_constant_field(const FieldRequest& freq, const ekat::ParameterList& ic_pl);
+  void initialize_ensemble_field(const FieldRequest& freq, const ekat::ParameterList& ens_pl);
   void register_groups ();
 
+  // Print the run timings of all atm procs (max over all ranks), one per line, in the form
+  //   Timing: <name> calls=<n> first=<t> total=<t> min=<t> max=<t> avg=<t> seconds
+  // where total/min/max/avg exclude the first call.
+  void report_timings () const;
+
   std::map<std::string,field_mgr_ptr>    m_field_mgrs;
 
   std::shared_ptr<AtmosphereProcessGroup>             m_atm_process_group;
 
+  // Optional check of water/energy conservation across the atm processes
+  std::shared_ptr<ConservationCheck>                  m_conservation_check;
+
   std::shared_ptr<GridsManager>                       m_grids_manager;
 
   ekat::ParameterList                                 m_atm_params;
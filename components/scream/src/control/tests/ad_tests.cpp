@@ -48,4 +48,57 @@ TEST_CASE ("group_requirements","[!throws]")
   dummy_atm_cleanup();
 }
 
+TEST_CASE ("ensemble_member_values","[!throws]")
+{
+  constexpr int num_cols    = 3;
+  constexpr int num_vl      = 2;
+  constexpr int num_members = 2;
+  const std::vector<double> values = {-1.0, 10.0};
+
+  // Load ad parameter list, and give A a different value in each member
+  std::string fname = "ad_tests.yaml";
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  REQUIRE_NOTHROW ( parse_yaml_file(fname,ad_params) );
+  ad_params.sublist("Initial Conditions").sublist("Ensemble Member Values").set("A",values);
+
+  // Create a comm
+  ekat::Comm atm_comm (MPI_COMM_WORLD);
+
+  // Setup the atm factories and grid manager, stacking the columns of all members
+  dummy_atm_init(num_cols, num_vl, atm_comm, num_members);
+
+  // Create the driver
+  control::AtmosphereDriver ad;
+
+  // Init the driver, and check that each column of A has the value of its member.
+  // The member of column gid is gid/num_cols (see create_point_grid). E is a copy of A.
+  util::TimeStamp init_time(0,0,0,0.0);
+  ad.initialize(atm_comm,ad_params,init_time);
+  auto field_mgr = ad.get_ref_grid_field_mgr();
+  const auto& grid = field_mgr->get_grid();
+  REQUIRE (grid->get_num_ensemble_members()==num_members);
+  auto gids = Kokkos::create_mirror_view(grid->get_dofs_gids());
+  Kokkos::deep_copy(gids,grid->get_dofs_gids());
+  const auto& view_A = field_mgr->get_field("A").get_reshaped_view<const Real**, Host>();
+  const auto& view_E = field_mgr->get_field("E").get_reshaped_view<const Real**, Host>();
+  for (int icol=0;icol<grid->get_num_local_dofs();++icol) {
+    const Real expected = values[gids(icol)/num_cols];
+    for (int jlev=0;jlev<num_vl;++jlev) {
+      REQUIRE(view_A(icol,jlev)==expected);
+      REQUIRE(view_E(icol,jlev)==expected);
+    }
+  }
+
+  // The number of values must match the number of members
+  ad.finalize ();
+  dummy_atm_cleanup();
+  ad_params.sublist("Initial Conditions").sublist("Ensemble Member Values").set("A",std::vector<double>{1.0});
+  dummy_atm_init(num_cols, num_vl, atm_comm, num_members);
+  control::AtmosphereDriver bad_ad;
+  REQUIRE_THROWS (bad_ad.initialize(atm_comm,ad_params,init_time));
+
+  // Cleanup atm factories and grids manager
+  dummy_atm_cleanup();
+}
+
 } // namespace scream
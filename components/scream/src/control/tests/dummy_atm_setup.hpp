@@ -9,7 +9,8 @@
 
 namespace scream {
 
-inline void dummy_atm_init (const int num_cols, const int nvl, const ekat::Comm& comm) {
+// Note: for an ensemble run (num_members>1), num_cols is the number of columns of each member.
+inline void dummy_atm_init (const int num_cols, const int nvl, const ekat::Comm& comm, const int num_members = 1) {
   using namespace scream;
 
   // Need to register products in the factory *before* we create any AtmosphereProcessGroup,
@@ -26,7 +27,7 @@ inline void dummy_atm_init (const int num_cols, const int nvl, const ekat::Comm&
   // Recall that this class stores *static* members, so whatever
   // we set here, will be reflected in the GM built by the factory.
   UserProvidedGridsManager upgm;
-  auto dummy_grid_a = create_point_grid("Point Grid",num_cols,nvl,comm);
+  auto dummy_grid_a = create_point_grid("Point Grid",num_cols,nvl,num_members,comm);
 
   upgm.set_grid(dummy_grid_a);
   upgm.set_reference_grid("Point Grid");
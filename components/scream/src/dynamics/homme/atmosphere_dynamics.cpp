@@ -516,16 +516,18 @@ void HommeDynamics::initialize_impl (const util::TimeStamp& /* t0 */)
 void HommeDynamics::run_impl (const Real dt)
 {
   try {
+    // Note: pre-process, hommexx and post-process kernels are all launched
+    //       on the default execution space, so they are already ordered.
+    //       The only host syncs needed are the ones before MPI calls, which
+    //       are done by the remappers and by Homme's boundary exchanges.
+
     // Prepare inputs for homme
-    Kokkos::fence();
     homme_pre_process (dt);
 
     // Run hommexx
-    Kokkos::fence();
     prim_run_f90 (dt);
 
     // Post process Homme's output, to produce what the rest of Atm expects
-    Kokkos::fence();
     homme_post_process ();
 
     // Get a copy of the current timestamp (at the beginning of the step) and
@@ -658,49 +660,44 @@ void HommeDynamics::homme_pre_process (const Real dt) {
   // Depending on ftype, we are going to modify it.
   //  ftype=0: FQ = dp*(Qnew-Qold) / dt
   //  ftype=2: FQ = dp*Qnew
-  switch(ftype) {
-    case ForcingAlg::FORCING_DEBUG:
-      // Back out tracers tendency for Qdp
-      Kokkos::parallel_for(Kokkos::RangePolicy<>(0,Q.size()),KOKKOS_LAMBDA(const int idx) {
-        const int ie = idx / (qsize*NP*NP*NVL);
-        const int iq = (idx / (NP*NP*NVL)) % qsize;
-        const int ip = (idx / (NP*NVL)) % NP;
-        const int jp = (idx / NVL) % NP;
-        const int k  =  idx % NVL;
-
-        // fq is currently storing q_new
-        const auto& q_prev = Q(ie,iq,ip,jp,k);
-        const auto& dp     = dp3d(ie,n0,ip,jp,k);
-              auto& fq     = FQ(ie,iq,ip,jp,k);
-
-        fq -= q_prev;
-        fq /= dt;
-        fq *= dp;
-      });
-      break;
-    case ForcingAlg::FORCING_2:
-      // Hard adjustment of qdp
-      Kokkos::parallel_for(Kokkos::RangePolicy<>(0,Q.size()),KOKKOS_LAMBDA(const int idx) {
-        const int ie = idx / (qsize*NP*NP*NVL);
-        const int iq = (idx / (NP*NP*NVL)) % qsize;
-        const int ip = (idx / (NP*NVL)) % NP;
-        const int jp = (idx / NVL) % NP;
-        const int k  =  idx % NVL;
-
+  EKAT_REQUIRE_MSG (ftype==ForcingAlg::FORCING_DEBUG || ftype==ForcingAlg::FORCING_2,
+      "Error! Unexpected/unsupported forcing algorithm.\n"
+      "  ftype: " + std::to_string(Homme::etoi(ftype)) + "\n");
+  const bool back_out_tendency = ftype==ForcingAlg::FORCING_DEBUG;
+
+  // Process all tracers of a gp/level in one pass, so that dp is loaded
+  // only once, rather than once per tracer.
+  const int nelem = Q.extent_int(0);
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  const auto policy = ESU::get_default_team_policy(nelem,NP*NP*NVL);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int ie = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,NP*NP*NVL),
+                         [&](const int idx) {
+      const int ip = idx / (NP*NVL);
+      const int jp = (idx / NVL) % NP;
+      const int k  =  idx % NVL;
+
+      const auto dp = dp3d(ie,n0,ip,jp,k);
+      for (int iq=0; iq<qsize; ++iq) {
         // fq is currently storing q_new
-              auto& qdp = Qdp(ie,n0_qdp,iq,ip,jp,k);
-        const auto& dp  = dp3d(ie,n0,ip,jp,k);
-        const auto& fq  = FQ(ie,iq,ip,jp,k);
-
-        qdp = fq*dp;
-      });
-      Kokkos::fence();
-
-      ff.tracers_forcing(dt,n0,n0_qdp,true,params.moisture);
+        auto& fq = FQ(ie,iq,ip,jp,k);
+        if (back_out_tendency) {
+          // Back out tracers tendency for Qdp
+          const auto& q_prev = Q(ie,iq,ip,jp,k);
+          fq -= q_prev;
+          fq /= dt;
+          fq *= dp;
+        } else {
+          // Hard adjustment of qdp
+          Qdp(ie,n0_qdp,iq,ip,jp,k) = fq*dp;
+        }
+      }
+    });
+  });
 
-    default:
-      EKAT_ERROR_MSG ("Error! Unexpected/unsupported forcing algorithm.\n"
-                      "  ftype: " + std::to_string(Homme::etoi(ftype)) + "\n");
+  if (!back_out_tendency) {
+    ff.tracers_forcing(dt,n0,n0_qdp,true,params.moisture);
   }
 }
 
@@ -1,6 +1,7 @@
 #include "dynamics/homme/dynamics_driven_grids_manager.hpp"
 #include "dynamics/homme/interface/scream_homme_interface.hpp"
 #include "dynamics/homme/physics_dynamics_remapper.hpp"
+#include "dynamics/homme/physics_dynamics_pg_remapper.hpp"
 
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
@@ -9,6 +10,8 @@
 // Get all Homme's compile-time dims
 #include "homme_dimensions.hpp"
 
+#include <fstream>
+
 namespace scream
 {
 
@@ -29,6 +32,14 @@ DynamicsDrivenGridsManager (const ekat::Comm& comm,
     init_params_f90 (nlname);
   }
 
+  // Element weights for the partition (only used by partmethod=23, SFCURVE_NODES).
+  // The file contains one weight per element, in global element order.
+  if (p.isSublist("Dynamics Driven") &&
+      p.sublist("Dynamics Driven").isParameter("Partition Element Weights File Name")) {
+    const auto& fname = p.sublist("Dynamics Driven").get<std::string>("Partition Element Weights File Name");
+    read_partition_elem_weights (comm,fname);
+  }
+
   // Valid names for the dyn grid
   auto& gn = m_valid_grid_names;
 
@@ -81,8 +92,22 @@ DynamicsDrivenGridsManager::do_create_remapper (const grid_ptr_type from_grid,
     } else {
       return std::make_shared<InverseRemapper<Real>>(pd_remapper);
     }
+  }
+
+  const auto& phys_name = p2d ? from : to;
+  if (phys_name=="Physics PG2" || phys_name=="Physics PG3" || phys_name=="Physics PG4") {
+    using PDR = PhysicsDynamicsPgRemapper<remapper_type::real_type>;
+
+    // The last digit of the grid code is N in pgN
+    const int pgN = m_grid_codes.at(phys_name) % 10;
+    auto pd_remapper = std::make_shared<PDR>(m_grids.at(phys_name),dyn_grid,pgN);
+    if (p2d) {
+      return pd_remapper;
+    } else {
+      return std::make_shared<InverseRemapper<Real>>(pd_remapper);
+    }
   } else {
-    ekat::error::runtime_abort("Error! P-D remapping only implemented for 'Physics GLL' phys grid.\n");
+    ekat::error::runtime_abort("Error! P-D remapping not implemented for '" + phys_name + "' phys grid.\n");
   }
   return nullptr;
 }
@@ -118,6 +143,11 @@ build_grids (const std::set<std::string>& grid_names,
     }
   }
 
+  if (m_part_elem_weights.size()>0) {
+    const double* weights = m_part_elem_weights.data();
+    const int nelem = m_part_elem_weights.size();
+    set_partition_elem_weights_f90 (weights,nelem);
+  }
   init_grids_f90 (pgN);
 
   // We know we need the dyn grid, so build it
@@ -137,6 +167,29 @@ build_grids (const std::set<std::string>& grid_names,
   cleanup_grid_init_data_f90 ();
 }
 
+void DynamicsDrivenGridsManager::
+read_partition_elem_weights (const ekat::Comm& comm, const std::string& fname) {
+  // Root reads the file, then broadcasts the weights to all ranks
+  int nelem = 0;
+  if (comm.am_i_root()) {
+    std::ifstream ifs(fname);
+    EKAT_REQUIRE_MSG (ifs.good(),
+        "Error! Could not open partition element weights file '" + fname + "'.\n");
+    double w;
+    while (ifs >> w) {
+      EKAT_REQUIRE_MSG (w>0,
+          "Error! Partition element weights must be positive (file '" + fname + "').\n");
+      m_part_elem_weights.push_back(w);
+    }
+    EKAT_REQUIRE_MSG (ifs.eof(),
+        "Error! Could not parse partition element weights file '" + fname + "'.\n");
+    nelem = m_part_elem_weights.size();
+  }
+  MPI_Bcast(&nelem,1,MPI_INT,0,comm.mpi_comm());
+  m_part_elem_weights.resize(nelem);
+  MPI_Bcast(m_part_elem_weights.data(),nelem,MPI_DOUBLE,0,comm.mpi_comm());
+}
+
 void DynamicsDrivenGridsManager::build_dynamics_grid () {
   if (m_grids.find("Dynamics")==m_grids.end()) {
 
@@ -232,11 +285,11 @@ build_grid_codes () {
   constexpr int gll   =  0;  // Physics GLL
   constexpr int pg2   =  2;  // Physics PG2
   constexpr int pg3   =  3;  // Physics PG3
-  constexpr int pg4   =  3;  // Physics PG4
+  constexpr int pg4   =  4;  // Physics PG4
   constexpr int gll_t = 10;  // Physics GLL Twin
   constexpr int pg2_t = 12;  // Physics PG2 Twin
   constexpr int pg3_t = 13;  // Physics PG3 Twin
-  constexpr int pg4_t = 13;  // Physics PG4 Twin
+  constexpr int pg4_t = 14;  // Physics PG4 Twin
 
   for (const auto& name : m_valid_grid_names) {
     int code;
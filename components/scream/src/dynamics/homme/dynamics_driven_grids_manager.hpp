@@ -3,6 +3,8 @@
 
 #include "share/grid/grids_manager.hpp"
 
+#include <vector>
+
 namespace scream
 {
 
@@ -42,6 +44,8 @@ protected:
 
   void build_grid_codes ();
 
+  void read_partition_elem_weights (const ekat::Comm& comm, const std::string& fname);
+
   grid_repo_type  m_grids;
 
   std::string m_ref_grid_name;
@@ -51,6 +55,9 @@ protected:
 
   // For each admissible grid name, store an integer code
   std::map<std::string, int> m_grid_codes;
+
+  // Optional per-element cost, used by Homme's SFCURVE_NODES partition method
+  std::vector<double> m_part_elem_weights;
 };
 
 inline std::shared_ptr<GridsManager>
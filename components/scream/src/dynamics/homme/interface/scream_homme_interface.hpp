@@ -38,6 +38,9 @@ bool is_hommexx_functors_inited_f90 ();
 void init_parallel_f90 (const int& f_comm);
 void init_params_f90 (const char*& fname);
 void init_grids_f90 (const int& pgN);
+// Per-element cost (global elem ordering), used by partmethod=23 (SFCURVE_NODES).
+// Must be called before init_grids_f90; weights are released by finalize_geometry_f90.
+void set_partition_elem_weights_f90 (const double* const& weights, const int& nelem);
 void cleanup_grid_init_data_f90 ();
 void finalize_geometry_f90 ();
 
@@ -62,6 +65,11 @@ void get_dyn_grid_data_f90 (AbstractGrid::gid_type* const& gids,
 void get_phys_grid_data_f90 (const int& pg_type,
                              AbstractGrid::gid_type* const& gids,
                              double* const& lat, double* const& lon, double* const& area);
+void get_pg_remap_data_f90 (double* const& g2f, double* const& f2g,
+                            double* const& w_ff, double* const& fv_metdet,
+                            double* const& D_f, double* const& Dinv_f,
+                            double* const& metdet, double* const& spheremp,
+                            double* const& D, double* const& Dinv);
 
 // Parmaters getters/setters
 int get_homme_int_param_f90(const char** name);
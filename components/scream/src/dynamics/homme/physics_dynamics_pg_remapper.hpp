@@ -0,0 +1,456 @@
+#ifndef SCREAM_PHYSICS_DYNAMICS_PG_REMAPPER_HPP
+#define SCREAM_PHYSICS_DYNAMICS_PG_REMAPPER_HPP
+
+#include "dynamics/homme/physics_dynamics_remapper.hpp"
+#include "dynamics/homme/interface/scream_homme_interface.hpp"
+
+#include <set>
+
+namespace scream
+{
+
+// Performs remap between a FV physics grid (pgN) and the dynamics grid.
+// Each SE element is split in NxN FV subcells, with the physics columns of
+// an element stored contiguously (subcell index k=i+j*N). The remap uses the
+// high-order, conservative operators of Homme's gllfvremap_mod, which only
+// depend on the reference element, and are therefore built once at init time:
+//  - dyn->phys (g2f): L2 projection of the GLL basis onto the FV subcells;
+//  - phys->dyn (f2g): high-order reconstruction on the GLL nodes, followed by
+//    a DSS (mass-weighted average of the nodes shared across elements).
+// Scalar quantities are remapped as densities (i.e., area-weighted). Vector
+// quantities on the sphere (e.g., horizontal winds) are remapped on the
+// reference element, to avoid steep gradients near the poles.
+// Note: unlike Homme's gfr_dyn_to_fv_phys, mixing ratios are not weighted by
+//       dp, and no limiter is applied. Hence, the remap conserves the area
+//       integral of each quantity, but does not prevent new extrema.
+template<typename RealType>
+class PhysicsDynamicsPgRemapper : public PhysicsDynamicsRemapper<RealType>
+{
+public:
+  using base_type       = PhysicsDynamicsRemapper<RealType>;
+  using real_type       = typename base_type::real_type;
+  using field_type      = typename base_type::field_type;
+  using grid_ptr_type   = typename base_type::grid_ptr_type;
+  using device_type     = typename base_type::device_type;
+  using Dims            = typename base_type::Dims;
+
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<int N>
+  using view_Nd = typename KT::template view_ND<Real,N>;
+
+  PhysicsDynamicsPgRemapper (const grid_ptr_type& phys_grid,
+                             const grid_ptr_type& dyn_grid,
+                             const int pgN);
+
+  ~PhysicsDynamicsPgRemapper () = default;
+
+  // Mark a physics field as a vector on the sphere. Must be called
+  // before the field is bound. By default, horiz winds are vectors.
+  void add_sphere_vector_field (const std::string& phys_field_name) {
+    m_sphere_vectors.insert(phys_field_name);
+  }
+
+  int get_pgN () const { return m_nf; }
+
+  // Strides (in Real's) of each dimension of the phys/dyn field.
+  // Dimensions that are not present in the layout have extent 1.
+  struct PgFieldInfo {
+    int ncmp;
+    int nlev;
+    bool is_vector;
+
+    int p_col_stride;
+    int p_cmp_stride;
+
+    int d_el_stride;
+    int d_tl_stride;
+    int d_cmp_stride;
+    int d_gp0_stride;
+    int d_gp1_stride;
+  };
+
+protected:
+
+  void do_remap_fwd () const override;
+  void do_remap_bwd () const override;
+
+  void initialize_device_variables () override;
+
+  void load_remap_data ();
+
+  int m_nf;
+  int m_nf2;
+  int m_num_elems;
+
+  std::set<std::string> m_sphere_vectors;
+
+  // Reference element remap operators
+  view_Nd<3>  m_g2f;        // (nf2,NP,NP)
+  view_Nd<3>  m_f2g;        // (NP,NP,nf2)
+  view_Nd<1>  m_w_ff;       // (nf2)
+
+  // FV subcells geometry
+  view_Nd<2>  m_fv_metdet;  // (nelem,nf2)
+  view_Nd<4>  m_D_f;        // (nelem,2,2,nf2)
+  view_Nd<4>  m_Dinv_f;     // (nelem,2,2,nf2)
+
+  // GLL geometry
+  view_Nd<3>  m_metdet;     // (nelem,NP,NP)
+  view_Nd<3>  m_spheremp;   // (nelem,NP,NP)
+  view_Nd<5>  m_D;          // (nelem,2,2,NP,NP)
+  view_Nd<5>  m_Dinv;       // (nelem,2,2,NP,NP)
+
+  typename KT::template view_1d<PgFieldInfo>  m_pg_info;
+};
+
+// ================= IMPLEMENTATION ================= //
+
+template<typename RealType>
+PhysicsDynamicsPgRemapper<RealType>::
+PhysicsDynamicsPgRemapper (const grid_ptr_type& phys_grid,
+                           const grid_ptr_type& dyn_grid,
+                           const int pgN)
+ : base_type(phys_grid,dyn_grid,false)
+ , m_nf (pgN)
+ , m_nf2 (pgN*pgN)
+{
+  EKAT_REQUIRE_MSG (pgN>=1 && pgN<=HOMMEXX_NP,
+      "Error! Invalid value for N in the pgN physics grid.\n");
+
+  m_num_elems = dyn_grid->get_num_local_dofs() / (HOMMEXX_NP*HOMMEXX_NP);
+  EKAT_REQUIRE_MSG (phys_grid->get_num_local_dofs()==m_num_elems*m_nf2,
+      "Error! Number of physics columns does not match the pgN grid.\n");
+
+  m_sphere_vectors.insert("horiz_winds");
+  m_sphere_vectors.insert("horiz_winds_prev");
+
+  load_remap_data ();
+}
+
+template<typename RealType>
+void PhysicsDynamicsPgRemapper<RealType>::
+load_remap_data ()
+{
+  constexpr int NP = HOMMEXX_NP;
+  const int ne  = m_num_elems;
+  const int nf2 = m_nf2;
+
+  m_g2f       = view_Nd<3>("g2f",nf2,NP,NP);
+  m_f2g       = view_Nd<3>("f2g",NP,NP,nf2);
+  m_w_ff      = view_Nd<1>("w_ff",nf2);
+  m_fv_metdet = view_Nd<2>("fv_metdet",ne,nf2);
+  m_D_f       = view_Nd<4>("D_f",ne,2,2,nf2);
+  m_Dinv_f    = view_Nd<4>("Dinv_f",ne,2,2,nf2);
+  m_metdet    = view_Nd<3>("metdet",ne,NP,NP);
+  m_spheremp  = view_Nd<3>("spheremp",ne,NP,NP);
+  m_D         = view_Nd<5>("D",ne,2,2,NP,NP);
+  m_Dinv      = view_Nd<5>("Dinv",ne,2,2,NP,NP);
+
+  auto h_g2f       = Kokkos::create_mirror_view(m_g2f);
+  auto h_f2g       = Kokkos::create_mirror_view(m_f2g);
+  auto h_w_ff      = Kokkos::create_mirror_view(m_w_ff);
+  auto h_fv_metdet = Kokkos::create_mirror_view(m_fv_metdet);
+  auto h_D_f       = Kokkos::create_mirror_view(m_D_f);
+  auto h_Dinv_f    = Kokkos::create_mirror_view(m_Dinv_f);
+  auto h_metdet    = Kokkos::create_mirror_view(m_metdet);
+  auto h_spheremp  = Kokkos::create_mirror_view(m_spheremp);
+  auto h_D         = Kokkos::create_mirror_view(m_D);
+  auto h_Dinv      = Kokkos::create_mirror_view(m_Dinv);
+
+  get_pg_remap_data_f90 (h_g2f.data(), h_f2g.data(), h_w_ff.data(),
+                         h_fv_metdet.data(), h_D_f.data(), h_Dinv_f.data(),
+                         h_metdet.data(), h_spheremp.data(), h_D.data(), h_Dinv.data());
+
+  Kokkos::deep_copy(m_g2f,      h_g2f);
+  Kokkos::deep_copy(m_f2g,      h_f2g);
+  Kokkos::deep_copy(m_w_ff,     h_w_ff);
+  Kokkos::deep_copy(m_fv_metdet,h_fv_metdet);
+  Kokkos::deep_copy(m_D_f,      h_D_f);
+  Kokkos::deep_copy(m_Dinv_f,   h_Dinv_f);
+  Kokkos::deep_copy(m_metdet,   h_metdet);
+  Kokkos::deep_copy(m_spheremp, h_spheremp);
+  Kokkos::deep_copy(m_D,        h_D);
+  Kokkos::deep_copy(m_Dinv,     h_Dinv);
+}
+
+template<typename RealType>
+void PhysicsDynamicsPgRemapper<RealType>::
+initialize_device_variables ()
+{
+  using namespace ShortFieldTagsNames;
+
+  base_type::initialize_device_variables();
+
+  const int num_fields = this->m_phys.size();
+  m_pg_info = decltype(m_pg_info)("pg_info",num_fields);
+  auto h_pg_info = Kokkos::create_mirror_view(m_pg_info);
+
+  // Strides of a row-major array with the given dims
+  auto get_strides = [](const Dims& d) {
+    std::vector<int> s(d.size,1);
+    for (int k=d.size-2; k>=0; --k) {
+      s[k] = s[k+1]*d.dims[k+1];
+    }
+    return s;
+  };
+
+  for (int i=0; i<num_fields; ++i) {
+    const auto& ph = this->m_phys[i].get_header();
+    const auto& dh = this->m_dyn[i].get_header();
+
+    // Subfields are remapped via their parent
+    if (ph.get_parent().lock()!=nullptr) {
+      continue;
+    }
+
+    const auto& pl = ph.get_identifier().get_layout();
+    const auto& dl = dh.get_identifier().get_layout();
+
+    const auto lt = get_layout_type(pl.tags());
+    EKAT_REQUIRE_MSG (lt==LayoutType::Scalar2D || lt==LayoutType::Vector2D ||
+                      lt==LayoutType::Scalar3D || lt==LayoutType::Vector3D,
+        "Error! PG remapper only supports scalar and vector fields.\n"
+        "       Field: " + ph.get_identifier().name() + "\n");
+
+    Dims pd, dd;
+    this->template compute_view_dims<Real>(ph.get_alloc_properties(),pl.dims(),pd);
+    this->template compute_view_dims<Real>(dh.get_alloc_properties(),dl.dims(),dd);
+    const auto ps = get_strides(pd);
+    const auto ds = get_strides(dd);
+
+    auto& info = h_pg_info(i);
+    info.ncmp = 1;
+    info.nlev = 1;
+    info.p_col_stride = ps[0];
+    info.p_cmp_stride = 0;
+    for (int k=1; k<pl.rank(); ++k) {
+      const auto t = pl.tag(k);
+      if (t==CMP) {
+        info.ncmp = pl.dim(k);
+        info.p_cmp_stride = ps[k];
+      } else if (t==LEV || t==ILEV) {
+        info.nlev = pl.dim(k);
+      }
+    }
+
+    info.d_el_stride  = ds[0];
+    info.d_tl_stride  = 0;
+    info.d_cmp_stride = 0;
+    int num_gp = 0;
+    for (int k=1; k<dl.rank(); ++k) {
+      const auto t = dl.tag(k);
+      if (t==TL) {
+        info.d_tl_stride = ds[k];
+      } else if (t==CMP) {
+        info.d_cmp_stride = ds[k];
+      } else if (t==GP) {
+        if (num_gp==0) {
+          info.d_gp0_stride = ds[k];
+        } else {
+          info.d_gp1_stride = ds[k];
+        }
+        ++num_gp;
+      }
+    }
+
+    info.is_vector = m_sphere_vectors.count(ph.get_identifier().name())==1;
+    EKAT_REQUIRE_MSG (!info.is_vector || info.ncmp==2,
+        "Error! Vector fields on the sphere must have 2 components.\n"
+        "       Field: " + ph.get_identifier().name() + "\n");
+  }
+
+  Kokkos::deep_copy(m_pg_info,h_pg_info);
+}
+
+template<typename RealType>
+void PhysicsDynamicsPgRemapper<RealType>::
+do_remap_fwd () const
+{
+  constexpr int NP = HOMMEXX_NP;
+  const auto& tl = Homme::Context::singleton().get<Homme::TimeLevel>();
+
+  const int num_fields = this->m_phys.size();
+  const int ne  = m_num_elems;
+  const int nf2 = m_nf2;
+  const int itl = tl.n0;
+
+  const auto has_parent = this->has_parent;
+  const auto is_state   = this->is_state_field_dev;
+  const auto phys_ptrs  = this->phys_ptrs;
+  const auto dyn_ptrs   = this->dyn_ptrs;
+  const auto pg_info    = m_pg_info;
+  const auto f2g        = m_f2g;
+  const auto fv_metdet  = m_fv_metdet;
+  const auto Dinv_f     = m_Dinv_f;
+  const auto metdet     = m_metdet;
+  const auto spheremp   = m_spheremp;
+  const auto D          = m_D;
+
+  // Phys->dyn on each element. The result is already multiplied by
+  // spheremp, so that the BE sum yields the mass-weighted average (DSS).
+  const auto f2g_loop = KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int i  = team.league_rank() / ne;
+    const int ie = team.league_rank() % ne;
+
+    if (has_parent(i)) return;
+
+    const auto& info = pg_info(i);
+    const Real* phys = phys_ptrs(i).ptr + ie*nf2*info.p_col_stride;
+    Real* dyn = dyn_ptrs(i).ptr + ie*info.d_el_stride + (is_state(i) ? itl*info.d_tl_stride : 0);
+
+    if (info.is_vector) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,NP*NP*info.nlev),
+                           [&](const int idx) {
+        const int igp  = idx / (NP*info.nlev);
+        const int jgp  = (idx / info.nlev) % NP;
+        const int ilev = idx % info.nlev;
+        Real wg[2] = {0,0};
+        for (int k=0; k<nf2; ++k) {
+          const Real u = phys[k*info.p_col_stride + ilev];
+          const Real v = phys[k*info.p_col_stride + info.p_cmp_stride + ilev];
+          for (int d=0; d<2; ++d) {
+            wg[d] += f2g(igp,jgp,k)*(Dinv_f(ie,d,0,k)*u + Dinv_f(ie,d,1,k)*v);
+          }
+        }
+        const int offset = igp*info.d_gp0_stride + jgp*info.d_gp1_stride + ilev;
+        for (int d=0; d<2; ++d) {
+          dyn[d*info.d_cmp_stride + offset] =
+            (D(ie,d,0,igp,jgp)*wg[0] + D(ie,d,1,igp,jgp)*wg[1])*spheremp(ie,igp,jgp);
+        }
+      });
+    } else {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,info.ncmp*NP*NP*info.nlev),
+                           [&](const int idx) {
+        const int icmp = idx / (NP*NP*info.nlev);
+        const int igp  = (idx / (NP*info.nlev)) % NP;
+        const int jgp  = (idx / info.nlev) % NP;
+        const int ilev = idx % info.nlev;
+        Real g = 0;
+        for (int k=0; k<nf2; ++k) {
+          g += f2g(igp,jgp,k)*fv_metdet(ie,k)*phys[k*info.p_col_stride + icmp*info.p_cmp_stride + ilev];
+        }
+        dyn[icmp*info.d_cmp_stride + igp*info.d_gp0_stride + jgp*info.d_gp1_stride + ilev] =
+          g / metdet(ie,igp,jgp) * spheremp(ie,igp,jgp);
+      });
+    }
+  };
+
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(num_fields*ne, NP*NP);
+  Kokkos::parallel_for(policy, f2g_loop);
+  Kokkos::fence();
+
+  // Exchange only the current time levels
+  this->m_be[tl.n0]->exchange();
+
+  // Complete the DSS, dividing by the assembled mass matrix
+  const auto rspheremp_loop = KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int i  = team.league_rank() / ne;
+    const int ie = team.league_rank() % ne;
+
+    if (has_parent(i)) return;
+
+    const auto& info = pg_info(i);
+    Real* dyn = dyn_ptrs(i).ptr + ie*info.d_el_stride + (is_state(i) ? itl*info.d_tl_stride : 0);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,info.ncmp*NP*NP*info.nlev),
+                         [&](const int idx) {
+      const int icmp = idx / (NP*NP*info.nlev);
+      const int igp  = (idx / (NP*info.nlev)) % NP;
+      const int jgp  = (idx / info.nlev) % NP;
+      const int ilev = idx % info.nlev;
+      dyn[icmp*info.d_cmp_stride + igp*info.d_gp0_stride + jgp*info.d_gp1_stride + ilev] /=
+        spheremp(ie,igp,jgp);
+    });
+  };
+  Kokkos::parallel_for(policy, rspheremp_loop);
+  Kokkos::fence();
+}
+
+template<typename RealType>
+void PhysicsDynamicsPgRemapper<RealType>::
+do_remap_bwd () const
+{
+  constexpr int NP = HOMMEXX_NP;
+  const auto& tl = Homme::Context::singleton().get<Homme::TimeLevel>();
+
+  const int num_fields = this->m_phys.size();
+  const int ne  = m_num_elems;
+  const int nf2 = m_nf2;
+  const int itl = tl.np1;
+
+  const auto has_parent = this->has_parent;
+  const auto is_state   = this->is_state_field_dev;
+  const auto phys_ptrs  = this->phys_ptrs;
+  const auto dyn_ptrs   = this->dyn_ptrs;
+  const auto pg_info    = m_pg_info;
+  const auto g2f        = m_g2f;
+  const auto w_ff       = m_w_ff;
+  const auto fv_metdet  = m_fv_metdet;
+  const auto D_f        = m_D_f;
+  const auto metdet     = m_metdet;
+  const auto Dinv       = m_Dinv;
+
+  // Dyn->phys on each element. No communication is needed, since
+  // each FV subcell is contained in a single element.
+  const auto g2f_loop = KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int i  = team.league_rank() / ne;
+    const int ie = team.league_rank() % ne;
+
+    if (has_parent(i)) return;
+
+    const auto& info = pg_info(i);
+    Real* phys = phys_ptrs(i).ptr + ie*nf2*info.p_col_stride;
+    const Real* dyn = dyn_ptrs(i).ptr + ie*info.d_el_stride + (is_state(i) ? itl*info.d_tl_stride : 0);
+
+    if (info.is_vector) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nf2*info.nlev),
+                           [&](const int idx) {
+        const int k    = idx / info.nlev;
+        const int ilev = idx % info.nlev;
+        Real wf[2] = {0,0};
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            const int offset = igp*info.d_gp0_stride + jgp*info.d_gp1_stride + ilev;
+            const Real u = dyn[offset];
+            const Real v = dyn[info.d_cmp_stride + offset];
+            for (int d=0; d<2; ++d) {
+              wf[d] += g2f(k,igp,jgp)*(Dinv(ie,d,0,igp,jgp)*u + Dinv(ie,d,1,igp,jgp)*v);
+            }
+          }
+        }
+        // On the reference element, the metric terms are trivial
+        for (int d=0; d<2; ++d) {
+          wf[d] /= w_ff(k);
+        }
+        for (int d=0; d<2; ++d) {
+          phys[k*info.p_col_stride + d*info.p_cmp_stride + ilev] =
+            D_f(ie,d,0,k)*wf[0] + D_f(ie,d,1,k)*wf[1];
+        }
+      });
+    } else {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,info.ncmp*nf2*info.nlev),
+                           [&](const int idx) {
+        const int icmp = idx / (nf2*info.nlev);
+        const int k    = (idx / info.nlev) % nf2;
+        const int ilev = idx % info.nlev;
+        Real f = 0;
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            f += g2f(k,igp,jgp)*metdet(ie,igp,jgp)*
+                 dyn[icmp*info.d_cmp_stride + igp*info.d_gp0_stride + jgp*info.d_gp1_stride + ilev];
+          }
+        }
+        phys[k*info.p_col_stride + icmp*info.p_cmp_stride + ilev] = f / (w_ff(k)*fv_metdet(ie,k));
+      });
+    }
+  };
+
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(num_fields*ne, nf2);
+  Kokkos::parallel_for(policy, g2f_loop);
+  Kokkos::fence();
+}
+
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_DYNAMICS_PG_REMAPPER_HPP
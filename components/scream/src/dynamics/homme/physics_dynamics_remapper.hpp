@@ -41,10 +41,13 @@ public:
   using pack_type = ekat::Pack<RealType,SCREAM_PACK_SIZE>;
   using small_pack_type = ekat::Pack<RealType,SCREAM_SMALL_PACK_SIZE>;
 
+  // If build_p2d_map=false, the phys->dyn dofs map is not built. This is needed
+  // if phys dofs are not a subset of the dyn dofs (e.g., phys grid is a FV grid).
   PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
-                           const grid_ptr_type& dyn_grid);
+                           const grid_ptr_type& dyn_grid,
+                           const bool build_p2d_map = true);
 
-  ~PhysicsDynamicsRemapper () = default;
+  virtual ~PhysicsDynamicsRemapper () = default;
 
   FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override;
   FieldLayout create_tgt_layout (const FieldLayout& src_layout) const override;
@@ -135,7 +138,7 @@ public:
   KokkosTypes<DefaultDevice>::view_1d<bool>                   is_state_field_dev;
   KokkosTypes<DefaultDevice>::view_1d<Kokkos::pair<int,int>>  time_levels;
 
-  void initialize_device_variables();
+  virtual void initialize_device_variables();
 
   template<typename ScalarT, typename AllocType>
   void compute_view_dims(const AllocType &alloc_prop, const std::vector<int> &field_dims, Dims &view_dims);
@@ -221,7 +224,8 @@ public:
 template<typename RealType>
 PhysicsDynamicsRemapper<RealType>::
 PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
-                         const grid_ptr_type& dyn_grid)
+                         const grid_ptr_type& dyn_grid,
+                         const bool build_p2d_map)
  : base_type(phys_grid,dyn_grid)
 {
   EKAT_REQUIRE_MSG(dyn_grid->type()==GridType::SE,     "Error! Input dynamics grid is not a SE grid.\n");
@@ -234,7 +238,9 @@ PhysicsDynamicsRemapper (const grid_ptr_type& phys_grid,
   // Notice that such dyn dof may not be unique (if phys dof is on an edge
   // of a SE element), but we don't care. We just need to find a match.
   // The BoundaryExchange already takes care of syncing all shared dyn dofs.
-  create_p2d_map ();
+  if (build_p2d_map) {
+    create_p2d_map ();
+  }
 }
 
 template<typename RealType>
@@ -0,0 +1,102 @@
+#include <catch2/catch.hpp>
+
+#include "dynamics/homme/interface/scream_homme_interface.hpp"
+#include "dynamics/homme/dynamics_driven_grids_manager.hpp"
+
+#include "Context.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+extern "C" {
+// These are specific C/F calls for these tests (i.e., not part of scream_homme_interface.hpp)
+void set_test_params_f90 (const int& ne_in);
+void set_test_partmethod_f90 (const int& partmethod_in);
+double get_local_elems_weight_f90 (const double* const& weights, const int& nelem_in);
+void cleanup_test_f90 ();
+}
+
+namespace {
+
+TEST_CASE("weighted_partition", "") {
+
+  using namespace scream;
+
+  // Create a comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Init homme context
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+
+  // Set parameters, and use the node-aware weighted SFC partition (SFCURVE_NODES=23)
+  constexpr int ne = 4;
+  constexpr int nelem = 6*ne*ne;
+  constexpr int sfcurve_nodes = 23;
+  set_test_params_f90 (ne);
+  set_test_partmethod_f90 (sfcurve_nodes);
+
+  // Non-uniform element weights (global element order): one element in five is 8x as expensive
+  std::vector<double> weights(nelem);
+  double wtot = 0, wmax = 0;
+  for (int ie=0; ie<nelem; ++ie) {
+    weights[ie] = ie%5==0 ? 8.0 : 1.0;
+    wtot += weights[ie];
+    wmax = std::max(wmax,weights[ie]);
+  }
+  const std::string weights_file = "homme_partition_weights.txt";
+  if (comm.am_i_root()) {
+    std::ofstream ofs(weights_file);
+    for (auto w : weights) {
+      ofs << w << "\n";
+    }
+  }
+  MPI_Barrier(comm.mpi_comm());
+
+  // Create the grids, feeding the weights through the grids manager params
+  ekat::ParameterList params;
+  params.sublist("Dynamics Driven").set<std::string>("Partition Element Weights File Name",weights_file);
+  {
+    DynamicsDrivenGridsManager gm(comm,params);
+    gm.build_grids({"Physics GLL","Dynamics"},"Physics GLL");
+
+    REQUIRE (get_num_global_elems_f90()==nelem);
+
+    // Each rank must own something
+    const int num_local_elems = get_num_local_elems_f90();
+    REQUIRE (num_local_elems>0);
+
+    // Gather the load of each rank
+    const double* wptr = weights.data();
+    const double my_load = get_local_elems_weight_f90(wptr,nelem);
+    double max_load, sum_load;
+    MPI_Allreduce(&my_load,&max_load,1,MPI_DOUBLE,MPI_MAX,comm.mpi_comm());
+    MPI_Allreduce(&my_load,&sum_load,1,MPI_DOUBLE,MPI_SUM,comm.mpi_comm());
+
+    // All elements are assigned exactly once
+    REQUIRE (sum_load==wtot);
+
+    // Each boundary of a rank's SFC segment is within max(wmax,part_tol*avg) of its
+    // balanced position (part_tol=0.05 in genspacepart_nodes), so the max load is bounded.
+    const double avg_load = wtot / comm.size();
+    const double part_tol = 0.05;
+    if (comm.am_i_root()) {
+      std::cout << " weighted partition: avg load = " << avg_load
+                << ", max load = " << max_load << "\n";
+    }
+    REQUIRE (max_load <= avg_load + 2*(wmax + part_tol*avg_load));
+  }
+
+  // Finalize Homme::Context
+  Homme::Context::finalize_singleton();
+
+  // Cleanup f90 structures
+  cleanup_test_f90();
+}
+
+} // anonymous namespace
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "dynamics/homme/physics_dynamics_remapper.hpp"
+#include "dynamics/homme/physics_dynamics_pg_remapper.hpp"
 #include "dynamics/homme/interface/scream_homme_interface.hpp"
 #include "share/field/field.hpp"
 #include "share/grid/se_grid.hpp"
@@ -17,6 +18,7 @@
 
 #include <random>
 #include <numeric>
+#include <cmath>
 
 extern "C" {
 // These are specific C/F calls for these tests (i.e., not part of scream_homme_interface.hpp)
@@ -1143,4 +1145,208 @@ TEST_CASE("combo_remap", "") {
   cleanup_test_f90();
 }
 
+
+TEST_CASE("pg_remap", "") {
+
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+
+  // Some type defs
+  using PackType = ekat::Pack<Homme::Real,HOMMEXX_VECTOR_SIZE>;
+  using Remapper = PhysicsDynamicsPgRemapper<Homme::Real>;
+  using FID = FieldIdentifier;
+  using FL  = FieldLayout;
+
+  // Create a comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Init homme context
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+
+  // We'll use this extensively, so let's use a short ref name
+  auto& c = Homme::Context::singleton();
+
+  // Set a value for qsize that is not the full qsize_d
+  auto& sp = c.create<Homme::SimulationParams>();
+  sp.qsize = std::max(HOMMEXX_QSIZE_D/2,1);
+
+  // Set parameters
+  constexpr int ne = 2;
+  set_test_params_f90 (ne);
+
+  // Create the grids
+  ekat::ParameterList params;
+  DynamicsDrivenGridsManager gm(comm,params);
+  std::set<std::string> grids_names = {"Physics PG2","Dynamics"};
+  gm.build_grids(grids_names,"Physics PG2");
+
+  // Get physics and dynamics grids
+  auto phys_grid = gm.get_grid("Physics PG2");
+  auto dyn_grid  = gm.get_grid("Dynamics");
+
+  // Get some dimensions for Homme
+  constexpr int np  = HOMMEXX_NP;
+  constexpr int NVL = HOMMEXX_NUM_PHYSICAL_LEV;
+  constexpr int NTL = HOMMEXX_NUM_TIME_LEVELS;
+  const int nle = get_num_local_elems_f90();
+  const int nlc = phys_grid->get_num_local_dofs();
+  REQUIRE (nlc==nle*4);
+  const auto units = ekat::units::m;  // Placeholder units (we don't care about units here)
+
+  c.create_if_not_there<Homme::TimeLevel>();
+  auto& tl = c.get<Homme::TimeLevel>();
+  tl.np1 = 0;
+  tl.nm1 = 1 % NTL;
+  tl.n0  = 2 % NTL;
+
+  // Create identifiers
+  const auto dgn = dyn_grid->name();
+  const auto pgn = phys_grid->name();
+  FID s_2d_dyn_fid  ("s_2d_dyn",  FL({EL,          GP, GP     },{nle,        np, np     }), units, dgn);
+  FID v_3d_dyn_fid  ("v_3d_dyn",  FL({EL,     CMP, GP, GP, LEV},{nle,     2, np, np, NVL}), units, dgn);
+  FID ss_3d_dyn_fid ("ss_3d_dyn", FL({EL, TL,      GP, GP, LEV},{nle, NTL,   np, np, NVL}), units, dgn);
+
+  FID s_2d_phys_fid  ("s_2d_phys",  FL({COL         },{nlc        }), units, pgn);
+  FID v_3d_phys_fid  ("v_3d_phys",  FL({COL, CMP, LEV},{nlc, 2, NVL}), units, pgn);
+  FID ss_3d_phys_fid ("ss_3d_phys", FL({COL,      LEV},{nlc,    NVL}), units, pgn);
+
+  // Create fields
+  Field<Real> s_2d_field_phys (s_2d_phys_fid);
+  Field<Real> v_3d_field_phys (v_3d_phys_fid);
+  Field<Real> ss_3d_field_phys (ss_3d_phys_fid);
+
+  Field<Real> s_2d_field_dyn (s_2d_dyn_fid);
+  Field<Real> v_3d_field_dyn (v_3d_dyn_fid);
+  Field<Real> ss_3d_field_dyn (ss_3d_dyn_fid);
+
+  // Request allocation to fit packs of reals for 3d views
+  v_3d_field_phys.get_header().get_alloc_properties().request_allocation<PackType>();
+  ss_3d_field_phys.get_header().get_alloc_properties().request_allocation<PackType>();
+  v_3d_field_dyn.get_header().get_alloc_properties().request_allocation<PackType>();
+  ss_3d_field_dyn.get_header().get_alloc_properties().request_allocation<PackType>();
+
+  // Allocate view
+  s_2d_field_phys.allocate_view();
+  v_3d_field_phys.allocate_view();
+  ss_3d_field_phys.allocate_view();
+  s_2d_field_dyn.allocate_view();
+  v_3d_field_dyn.allocate_view();
+  ss_3d_field_dyn.allocate_view();
+
+  // Build the remapper, and register the fields
+  std::shared_ptr<Remapper> remapper(new Remapper(phys_grid,dyn_grid,2));
+  remapper->registration_begins();
+  remapper->register_field(s_2d_field_phys, s_2d_field_dyn);
+  remapper->register_field(v_3d_field_phys, v_3d_field_dyn);
+  remapper->register_field(ss_3d_field_phys, ss_3d_field_dyn);
+  remapper->registration_ends();
+
+  // The remap operators are high order and conservative, hence they must
+  // preserve constants (up to round off) in both directions. Note: the
+  // vector field is not registered as a vector on the sphere, so its
+  // components are remapped as independent scalars.
+  const Real s_val = 2.5;
+  const Real v_val[2] = {-1.0, 3.0};
+  const Real ss_val = 7.0;
+  const Real tol = 1e-12;
+
+  SECTION ("pg_remap") {
+    for (bool fwd : {true, false}) {
+      if (comm.am_i_root()) {
+        std::cout << " -> PG2 remap " << (fwd ? " forward\n" : " backward\n");
+      }
+
+      if (fwd) {
+        auto s_2d = s_2d_field_phys.get_reshaped_view<Homme::Real*,Host>();
+        auto v_3d = v_3d_field_phys.get_reshaped_view<Homme::Real***,Host>();
+        auto ss_3d = ss_3d_field_phys.get_reshaped_view<Homme::Real**,Host>();
+        for (int icol=0; icol<nlc; ++icol) {
+          s_2d(icol) = s_val;
+          for (int il=0; il<NVL; ++il) {
+            v_3d(icol,0,il) = v_val[0];
+            v_3d(icol,1,il) = v_val[1];
+            ss_3d(icol,il) = ss_val;
+          }
+        }
+        s_2d_field_phys.sync_to_dev();
+        v_3d_field_phys.sync_to_dev();
+        ss_3d_field_phys.sync_to_dev();
+      } else {
+        auto s_2d = s_2d_field_dyn.get_reshaped_view<Homme::Real***,Host>();
+        auto v_3d = v_3d_field_dyn.get_reshaped_view<Homme::Real*****,Host>();
+        auto ss_3d = ss_3d_field_dyn.get_reshaped_view<Homme::Real*****,Host>();
+        for (int ie=0; ie<nle; ++ie) {
+          for (int ip=0; ip<np; ++ip) {
+            for (int jp=0; jp<np; ++jp) {
+              s_2d(ie,ip,jp) = s_val;
+              for (int il=0; il<NVL; ++il) {
+                v_3d(ie,0,ip,jp,il) = v_val[0];
+                v_3d(ie,1,ip,jp,il) = v_val[1];
+                for (int itl=0; itl<NTL; ++itl) {
+                  ss_3d(ie,itl,ip,jp,il) = ss_val;
+                }
+              }
+            }
+          }
+        }
+        s_2d_field_dyn.sync_to_dev();
+        v_3d_field_dyn.sync_to_dev();
+        ss_3d_field_dyn.sync_to_dev();
+      }
+
+      // Remap
+      remapper->remap(fwd);
+
+      // Check
+      if (fwd) {
+        s_2d_field_dyn.sync_to_host();
+        v_3d_field_dyn.sync_to_host();
+        ss_3d_field_dyn.sync_to_host();
+        auto s_2d = s_2d_field_dyn.get_reshaped_view<Homme::Real***,Host>();
+        auto v_3d = v_3d_field_dyn.get_reshaped_view<Homme::Real*****,Host>();
+        auto ss_3d = ss_3d_field_dyn.get_reshaped_view<Homme::Real*****,Host>();
+        for (int ie=0; ie<nle; ++ie) {
+          for (int ip=0; ip<np; ++ip) {
+            for (int jp=0; jp<np; ++jp) {
+              REQUIRE (std::abs(s_2d(ie,ip,jp)-s_val)<tol*std::abs(s_val));
+              for (int il=0; il<NVL; ++il) {
+                REQUIRE (std::abs(v_3d(ie,0,ip,jp,il)-v_val[0])<tol*std::abs(v_val[0]));
+                REQUIRE (std::abs(v_3d(ie,1,ip,jp,il)-v_val[1])<tol*std::abs(v_val[1]));
+                REQUIRE (std::abs(ss_3d(ie,tl.n0,ip,jp,il)-ss_val)<tol*std::abs(ss_val));
+              }
+            }
+          }
+        }
+      } else {
+        s_2d_field_phys.sync_to_host();
+        v_3d_field_phys.sync_to_host();
+        ss_3d_field_phys.sync_to_host();
+        auto s_2d = s_2d_field_phys.get_reshaped_view<Homme::Real*,Host>();
+        auto v_3d = v_3d_field_phys.get_reshaped_view<Homme::Real***,Host>();
+        auto ss_3d = ss_3d_field_phys.get_reshaped_view<Homme::Real**,Host>();
+        for (int icol=0; icol<nlc; ++icol) {
+          REQUIRE (std::abs(s_2d(icol)-s_val)<tol*std::abs(s_val));
+          for (int il=0; il<NVL; ++il) {
+            REQUIRE (std::abs(v_3d(icol,0,il)-v_val[0])<tol*std::abs(v_val[0]));
+            REQUIRE (std::abs(v_3d(icol,1,il)-v_val[1])<tol*std::abs(v_val[1]));
+            REQUIRE (std::abs(ss_3d(icol,il)-ss_val)<tol*std::abs(ss_val));
+          }
+        }
+      }
+    }
+  }
+
+  // Delete remapper before finalizing the mpi context, since the remapper has some MPI stuff in it
+  remapper = nullptr;
+
+  // Finalize Homme::Context
+  Homme::Context::finalize_singleton();
+
+  // Cleanup f90 structures
+  cleanup_test_f90();
+}
+
 } // anonymous namespace
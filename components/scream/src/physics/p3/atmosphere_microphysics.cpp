@@ -24,7 +24,19 @@ P3Microphysics::P3Microphysics (const ekat::Comm& comm, const ekat::ParameterLis
  : m_p3_comm (comm)
  , m_p3_params (params)
 {
-  // Nothing to do here
+  // Team and vector sizes for p3_main (a team size of 0 means the default policy is used)
+  m_team_size   = m_p3_params.isParameter("Team Size")   ? m_p3_params.get<int>("Team Size")   : 0;
+  m_vector_size = m_p3_params.isParameter("Vector Size") ? m_p3_params.get<int>("Vector Size") : 1;
+  EKAT_REQUIRE_MSG(m_team_size>=0, "Error! P3 'Team Size' must be non-negative.\n");
+  EKAT_REQUIRE_MSG(m_vector_size>=1, "Error! P3 'Vector Size' must be positive.\n");
+
+  // Runtime selection of the team size (see util::TeamSizeTuner)
+  m_autotune = m_p3_params.isParameter("Autotune Team Size") && m_p3_params.get<bool>("Autotune Team Size");
+  m_tuning_cache_file = m_p3_params.isParameter("Tuning Cache File") ? m_p3_params.get<std::string>("Tuning Cache File")
+                                                                  : "scream_tuning_cache.txt";
+  m_tuning_cache_only = m_p3_params.isParameter("Tuning Cache Only") && m_p3_params.get<bool>("Tuning Cache Only");
+  EKAT_REQUIRE_MSG(not (m_autotune && m_team_size>0),
+      "Error! P3 'Team Size' and 'Autotune Team Size' cannot be used together.\n");
 }
 
 // =========================================================================================
@@ -88,6 +100,7 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
 
   // Diagnostic Outputs: (all fields are just outputs w.r.t. P3)
   add_field<Computed>("precip_liq_surf",    scalar2d_layout,     m/s,    grid_name);
+  add_field<Computed>("precip_ice_surf",    scalar2d_layout,     m/s,    grid_name);
   add_field<Computed>("eff_radius_qc",      scalar3d_layout_mid, micron, grid_name, ps);
   add_field<Computed>("eff_radius_qi",      scalar3d_layout_mid, micron, grid_name, ps);
 
@@ -96,6 +109,21 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   add_field<Computed>("micro_vap_liq_exchange", scalar3d_layout_mid, Q, grid_name, ps);
   add_field<Computed>("micro_vap_ice_exchange", scalar3d_layout_mid, Q, grid_name, ps);
 
+  // Team policy for p3_main. It is needed to size the workspace manager buffer,
+  // so build it as soon as the number of columns is known.
+  const int npacks = ekat::npack<Spack>(m_num_levs);
+  if (m_autotune) {
+    // All ranks must agree on whether tuning happens (timings are reduced
+    // across ranks), so the key uses the max number of columns over all ranks.
+    int max_cols = m_num_cols;
+    MPI_Allreduce(MPI_IN_PLACE, &max_cols, 1, MPI_INT, MPI_MAX, m_p3_comm.mpi_comm());
+    const auto key = util::TeamSizeTuner::make_key<KT::ExeSpace>("p3_main",max_cols,m_num_levs);
+    m_tuner = util::TeamSizeTuner(key, util::team_size_candidates<KT::ExeSpace>(npacks),
+                                  m_tuning_cache_file, m_p3_comm, m_tuning_cache_only);
+  } else {
+    m_tuner = util::TeamSizeTuner(m_team_size);
+  }
+  m_policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, npacks, m_tuner.team_size(), m_vector_size);
 }
 
 // =========================================================================================
@@ -106,8 +134,6 @@ int P3Microphysics::requested_buffer_size_in_bytes() const
 
   // Number of Reals needed by local views in the interface
   const int interface_request =
-      // 1d view scalar, size (ncol)
-      Buffer::num_1d_scalar*m_num_cols*sizeof(Real) +
       // 2d view packed, size (ncol, nlev_packs)
       Buffer::num_2d_vector*m_num_cols*nk_pack*sizeof(Spack) +
       Buffer::num_2dp1_vector*m_num_cols*nk_pack_p1*sizeof(Spack) +
@@ -115,8 +141,12 @@ int P3Microphysics::requested_buffer_size_in_bytes() const
       m_num_cols*3*sizeof(Real);
 
   // Number of Reals needed by the WorkspaceManager passed to p3_main
-  const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  const int wsm_request   = WSM::get_total_bytes_needed(nk_pack, 52, policy);
+  // While the team size is being tuned, the policy changes, so use the max over all candidates.
+  int wsm_request = 0;
+  for (const int ts : m_tuner.candidates()) {
+    const auto policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, nk_pack, ts, m_vector_size);
+    wsm_request = std::max(wsm_request, WSM::get_total_bytes_needed(nk_pack, 52, policy));
+  }
 
   return interface_request + wsm_request;
 }
@@ -128,10 +158,6 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
 
   Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
 
-  // 1d scalar views
-  m_buffer.precip_ice_surf = decltype(m_buffer.precip_ice_surf)(mem, m_num_cols);
-  mem += m_buffer.precip_ice_surf.size();
-
   // 2d scalar views
   m_buffer.col_location = decltype(m_buffer.col_location)(mem, m_num_cols, 3);
   mem += m_buffer.col_location.size();
@@ -168,8 +194,11 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
 
   // Compute workspace manager size to check used memory
   // vs. requested memory
-  const auto policy  = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  const int wsm_size = WSM::get_total_bytes_needed(nk_pack, 52, policy)/sizeof(Spack);
+  int wsm_size = 0;
+  for (const int ts : m_tuner.candidates()) {
+    const auto policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, nk_pack, ts, m_vector_size);
+    wsm_size = std::max(wsm_size, WSM::get_total_bytes_needed(nk_pack, 52, policy)/int(sizeof(Spack)));
+  }
   s_mem += wsm_size;
 
   int used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -238,7 +267,7 @@ void P3Microphysics::initialize_impl (const util::TimeStamp& t0)
   diag_outputs.diag_eff_radius_qi = m_p3_fields_out["eff_radius_qi"].get_reshaped_view<Pack**>();
 
   diag_outputs.precip_liq_surf  = m_p3_fields_out["precip_liq_surf"].get_reshaped_view<Real*>();
-  diag_outputs.precip_ice_surf  = m_buffer.precip_ice_surf;
+  diag_outputs.precip_ice_surf  = m_p3_fields_out["precip_ice_surf"].get_reshaped_view<Real*>();
   diag_outputs.qv2qi_depos_tend = m_buffer.qv2qi_depos_tend;
   diag_outputs.rho_qi           = m_buffer.rho_qi;
   diag_outputs.precip_liq_flux  = m_buffer.precip_liq_flux;
@@ -253,6 +282,10 @@ void P3Microphysics::initialize_impl (const util::TimeStamp& t0)
   infrastructure.predictNc = true;     // Hard-coded for now, TODO: make this a runtime option 
   infrastructure.prescribedCCN = true; // Hard-coded for now, TODO: make this a runtime option
   infrastructure.col_location = m_buffer.col_location; // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
+  infrastructure.implicitSed = false;
+  if (m_p3_params.isParameter("Implicit Sedimentation")) {
+    infrastructure.implicitSed = m_p3_params.get<bool>("Implicit Sedimentation");
+  }
   // --History Only
   history_only.liq_ice_exchange = m_p3_fields_out["micro_liq_ice_exchange"].get_reshaped_view<Pack**>();
   history_only.vap_liq_exchange = m_p3_fields_out["micro_vap_liq_exchange"].get_reshaped_view<Pack**>();
@@ -260,6 +293,9 @@ void P3Microphysics::initialize_impl (const util::TimeStamp& t0)
   // -- Set values for the post-amble structure
   p3_postproc.set_variables(m_num_cols,nk_pack,prog_state.th,pmid,T_atm,t_prev,prog_state.qv,qv_prev,
       diag_outputs.diag_eff_radius_qc,diag_outputs.diag_eff_radius_qi);
+
+  // WorkspaceManager for internal local variables
+  m_workspace_mgr = std::make_shared<WSM>(m_buffer.wsm_data, nk_pack, 52, m_policy);
 }
 
 // =========================================================================================
@@ -293,14 +329,21 @@ void P3Microphysics::run_impl (const Real dt)
   infrastructure.dt = dt;
   infrastructure.it++;
 
-  // WorkspaceManager for internal local variables
-  const Int nk_pack = ekat::npack<Spack>(m_num_levs);
-  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(m_buffer.wsm_data, nk_pack, 52, policy);
-
   // Run p3 main
-  P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
-               history_only, workspace_mgr, m_num_cols, m_num_levs);
+  const auto elapsed = P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
+                                    history_only, m_policy, *m_workspace_mgr, m_num_cols, m_num_levs);
+
+  // While tuning the team size, record the time of the slowest rank, and
+  // switch to the next candidate (or to the selected team size).
+  if (m_tuner.is_tuning()) {
+    double max_elapsed = elapsed;
+    MPI_Allreduce(MPI_IN_PLACE, &max_elapsed, 1, MPI_DOUBLE, MPI_MAX, m_p3_comm.mpi_comm());
+    m_tuner.record(max_elapsed);
+
+    const Int nk_pack = ekat::npack<Spack>(m_num_levs);
+    m_policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, nk_pack, m_tuner.team_size(), m_vector_size);
+    m_workspace_mgr = std::make_shared<WSM>(m_buffer.wsm_data, nk_pack, 52, m_policy);
+  }
 
   // Conduct the post-processing of the p3_main output.
   Kokkos::parallel_for(
@@ -323,7 +366,8 @@ void P3Microphysics::run_impl (const Real dt)
 // =========================================================================================
 void P3Microphysics::finalize_impl()
 {
-  // Do nothing
+  // Release the workspace manager, which holds device views
+  m_workspace_mgr = nullptr;
 }
 
 void P3Microphysics::set_required_field_impl (const Field<const Real>& f) {
@@ -6,8 +6,10 @@
 #include "physics/p3/p3_main_impl.hpp"
 #include "physics/p3/p3_functions.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "share/util/scream_team_size_tuner.hpp"
 
 #include <string>
+#include <memory>
 
 namespace scream
 {
@@ -214,13 +216,10 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-    // 1d view scalar, size (ncol)
-    static constexpr int num_1d_scalar = 1;
     // 2d view packed, size (ncol, nlev_packs)
     static constexpr int num_2d_vector = 8;
     static constexpr int num_2dp1_vector = 2;
 
-    uview_1d precip_ice_surf;
     uview_2d inv_exner;
     uview_2d th_atm;
     uview_2d cld_frac_l;
@@ -282,6 +281,24 @@ protected:
   Int m_num_levs;
   Int m_nk_pack;
 
+  // Team policy and workspace manager for p3_main. They are built once, and
+  // reused at every step. The team and vector sizes can be set via the
+  // "Team Size" and "Vector Size" parameters (by default, the policy is the
+  // default one for the execution space). Alternatively, with "Autotune Team
+  // Size", the team size is selected at runtime by timing p3_main during the
+  // first steps, and the choice is stored in "Tuning Cache File" for later runs.
+  // Results depend on the team size at round-off level (e.g., the team
+  // reductions in the sedimentation routines), so runs that must be BFB should
+  // not tune, or set "Tuning Cache Only" to pin the previously tuned team size.
+  int                  m_team_size;
+  int                  m_vector_size;
+  bool                 m_autotune;
+  std::string          m_tuning_cache_file;
+  bool                 m_tuning_cache_only;
+  util::TeamSizeTuner  m_tuner;
+  KT::TeamPolicy       m_policy;
+  std::shared_ptr<WSM> m_workspace_mgr;
+
   // Struct which contains local variables
   Buffer m_buffer;
 
@@ -86,6 +86,7 @@ struct Functions
   using uview_2d = typename ekat::template Unmanaged<view_2d<S> >;
 
   using MemberType = typename KT::MemberType;
+  using TeamPolicy = typename KT::TeamPolicy;
 
   using WorkspaceManager = typename ekat::WorkspaceManager<Spack, Device>;
   using Workspace        = typename WorkspaceManager::Workspace;
@@ -188,6 +189,9 @@ struct Functions
     bool prescribedCCN;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
+    // Set to true to use the fixed-cost implicit scheme for rain and ice
+    // sedimentation, rather than adaptive substepping.
+    bool implicitSed = false;
   };
 
   // This struct stores tendencies computed by P3 and used by other
@@ -306,6 +310,16 @@ struct Functions
                                const TableIce& tab,
                                const Smask& context = Smask(true) );
 
+  // Apply TableIce data to the ice tables to return the values of several
+  // processes, given by their indices in idx, into proc. All the processes of
+  // a table node are contiguous in memory, so the interpolation stencil is
+  // loaded once for all of them.
+  template <int N>
+  KOKKOS_FUNCTION
+  static void apply_table_ice(const Int (&idx)[N], const view_ice_table& ice_table_vals,
+                              const TableIce& tab, Spack (&proc)[N],
+                              const Smask& context = Smask(true) );
+
   // Interpolates lookup table values for rain/ice collection processes
   KOKKOS_FUNCTION
   static Spack apply_table_coll(const int& index, const view_collect_table& collect_table_vals,
@@ -378,6 +392,23 @@ struct Functions
     const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
     const view_1d_ptr_array<Spack, nfield>& rs);
 
+  // Fixed-cost alternative to generalized_sedimentation: a single backward
+  // Euler step of the first-order upwind scheme over all of dt_left, which is
+  // unconditionally stable. Its cost does not depend on the fall speeds, so
+  // heavy-precip columns do not hold up the rest of the launch. On output,
+  // dt_left is 0 and k_qxbot is kbot.
+  template <int nfield>
+  KOKKOS_FUNCTION
+  static void implicit_sedimentation(
+    const uview_1d<const Spack>& rho,
+    const uview_1d<const Spack>& inv_rho,
+    const uview_1d<const Spack>& inv_dz,
+    const MemberType& team,
+    const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, Scalar& dt_left, Scalar& prt_accum,
+    const view_1d_ptr_array<Spack, nfield>& fluxes,
+    const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+    const view_1d_ptr_array<Spack, nfield>& rs);
+
   // Cloud sedimentation
   KOKKOS_FUNCTION
   static void cloud_sedimentation(
@@ -422,7 +453,8 @@ struct Functions
     const uview_1d<Spack>& precip_liq_flux,
     const uview_1d<Spack>& qr_tend,
     const uview_1d<Spack>& nr_tend,
-    Scalar& precip_liq_surf);
+    Scalar& precip_liq_surf,
+    const bool& do_implicit_sed = false);
 
   // TODO: comment
   KOKKOS_FUNCTION
@@ -446,7 +478,8 @@ struct Functions
     const uview_1d<Spack>& qi_tend,
     const uview_1d<Spack>& ni_tend,
     const view_ice_table& ice_table_vals,
-    Scalar& precip_ice_surf);
+    Scalar& precip_ice_surf,
+    const bool& do_implicit_sed = false);
 
   // homogeneous freezing of cloud and rain
   KOKKOS_FUNCTION
@@ -961,6 +994,20 @@ struct Functions
     Int nj, // number of columns
     Int nk); // number of vertical cells per column
 
+  // Same as above, but p3_main's kernels are launched with the given team
+  // policy, which must be the one workspace_mgr was built with. This allows
+  // callers to build (and tune) the policy and the workspace manager once.
+  static Int p3_main(
+    const P3PrognosticState& prognostic_state,
+    const P3DiagnosticInputs& diagnostic_inputs,
+    const P3DiagnosticOutputs& diagnostic_outputs,
+    const P3Infrastructure& infrastructure,
+    const P3HistoryOnly& history_only,
+    const TeamPolicy& policy,
+    const WorkspaceManager& workspace_mgr,
+    Int nj, // number of columns
+    Int nk); // number of vertical cells per column
+
   KOKKOS_FUNCTION
   static void ice_supersat_conservation(Spack& qidep, Spack& qinuc, const Spack& cld_frac_i, const Spack& qv, const Spack& qv_sat_i, const Spack& latent_heat_sublim, const Spack& t_atm, const Real& dt, const Spack& qi2qv_sublim_tend, const Spack& qr2qv_evap_tend, const Smask& context = Smask(true));
 
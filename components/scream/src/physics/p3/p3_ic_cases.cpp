@@ -1,5 +1,6 @@
 #include "p3_ic_cases.hpp"
 #include "physics_constants.hpp"
+#include "physics_ic_regimes.hpp"
 
 #include "ekat/ekat_assert.hpp"
 
@@ -116,9 +117,133 @@ FortranData::Ptr make_mixed (const Int ncol, const Int nlev) {
   return dp;
 }
 
+FortranData::Ptr make_regimes (const Int ncol, const Int nlev, const unsigned seed) {
+  using consts = scream::physics::Constants<Real>;
+  using physics::Regime;
+
+  static constexpr Real mincld = 0.0001;
+  static constexpr Real H = 7500;         // scale height, m (only used to place clouds)
+
+  const Int nk = nlev;
+  const auto dp = std::make_shared<FortranData>(ncol, nk);
+  auto& d = *dp;
+
+  const auto regimes = physics::sample_column_regimes(ncol, physics::default_regime_weights(), seed);
+  for (Int i = 0; i < ncol; ++i) {
+    const auto regime = regimes[i].regime;
+    const Real a = regimes[i].strength;
+
+    // Surface temperature and lapse rate
+    Real T_sfc = 0, lapse = 0;
+    switch (regime) {
+      case Regime::ClearSky:       T_sfc = 295 + 5*a;  lapse = 6.5e-3; break;
+      case Regime::Stratocumulus:  T_sfc = 288 + 3*a;  lapse = 6.0e-3; break;
+      case Regime::DeepConvection: T_sfc = 300 + 2*a;  lapse = 6.5e-3; break;
+      case Regime::PolarIce:       T_sfc = 250 + 8*a;  lapse = 4.0e-3; break;
+      default:
+        EKAT_ERROR_MSG("Error! Unhandled regime " + physics::e2str(regime) + ".\n");
+    }
+
+    // Heights (m) of the cloud bottom/top, and of the top of the moist layer
+    Real z_cb = 0, z_ct = 0, z_moist = 0;
+    switch (regime) {
+      case Regime::ClearSky:       z_moist = 1500 + 1500*a; break;
+      case Regime::Stratocumulus:  z_ct = 800 + 600*a;  z_cb = z_ct - 300 - 200*a; z_moist = z_ct; break;
+      case Regime::DeepConvection: z_cb = 800;  z_ct = 9000 + 5000*a; z_moist = z_ct; break;
+      case Regime::PolarIce:       z_cb = 200;  z_ct = 1500 + 2000*a; z_moist = z_ct; break;
+      default:
+        EKAT_ERROR_MSG("Error! Unhandled regime " + physics::e2str(regime) + ".\n");
+    }
+
+    for (Int k = 0; k < nk; ++k) {
+      d.pres(i,k) = 100 + 1e5/double(nk)*k;
+      d.dpres(i,k) = 1e5/double(nk);
+      d.inv_exner(i,k) = std::pow((1e5/d.pres(i,k)), (287.15/1005.0));
+      d.inv_qc_relvar(i,k) = 1.0;
+
+      const Real z = H*std::log(1e5/d.pres(i,k));
+      const Real T = std::max(T_sfc - lapse*z, Real(190));
+      const bool in_cloud = z>=z_cb && z<=z_ct;
+      // Relative position inside the cloud (0 at the bottom, 1 at the top)
+      const Real zc = in_cloud ? (z-z_cb)/(z_ct-z_cb) : 0;
+
+      Real rh = z<=z_moist ? 0.8 : 0.2;
+      switch (regime) {
+        case Regime::ClearSky:
+          rh = z<=z_moist ? 0.5 + 0.2*a : 0.1;
+          break;
+        case Regime::Stratocumulus:
+          if (in_cloud) {
+            // Liquid cloud thickening towards its top, drizzling below
+            rh = 1.0;
+            d.qc(i,k) = (0.5 + a)*5e-4*zc;
+            d.nc(i,k) = 1e8;
+          }
+          if (z<=z_ct) {
+            d.qr(i,k) = (0.5 + a)*1e-6;
+            d.nr(i,k) = 1e4;
+          }
+          break;
+        case Regime::DeepConvection:
+          if (in_cloud) {
+            rh = 1.0;
+            if (T>consts::Tmelt) {
+              d.qc(i,k) = (0.5 + a)*1e-3;
+              d.nc(i,k) = 5e7;
+            } else {
+              // Rimed ice above the freezing level
+              d.qi(i,k) = (0.5 + a)*5e-4*(1 - 0.5*zc);
+              d.ni(i,k) = 1e5;
+              d.qm(i,k) = 0.5*d.qi(i,k);
+              d.bm(i,k) = d.qm(i,k)/400; // rime density 400 kg/m3
+            }
+          }
+          if (z<=z_ct && T>consts::T_homogfrz) {
+            // Heavy rain from the (supercooled) cloud to the surface
+            d.qr(i,k) = (0.5 + a)*1e-3;
+            d.nr(i,k) = 1e4;
+          }
+          break;
+        case Regime::PolarIce:
+          if (in_cloud) {
+            // Subsaturated w.r.t. liquid but supersaturated w.r.t. ice,
+            // with a thin supercooled liquid layer at the top
+            rh = 0.9;
+            d.qi(i,k) = (0.5 + a)*5e-5;
+            d.ni(i,k) = 1e4;
+            if (zc>0.8) {
+              rh = 1.0;
+              d.qc(i,k) = (0.5 + a)*5e-5;
+              d.nc(i,k) = 5e7;
+            }
+          }
+          break;
+        default:
+          EKAT_ERROR_MSG("Error! Unhandled regime " + physics::e2str(regime) + ".\n");
+      }
+
+      d.qv(i,k) = rh*physics::ic_saturation_mixing_ratio(T, d.pres(i,k));
+      d.th_atm(i,k) = T*std::pow(Real(consts::P0/d.pres(i,k)), Real(consts::RD/consts::CP));
+
+      d.cld_frac_l(i,k) = d.qc(i,k)>0 ? 1.0 : mincld;
+      d.cld_frac_i(i,k) = d.qi(i,k)>0 ? 1.0 : mincld;
+      d.cld_frac_r(i,k) = d.qr(i,k)>0 ? 1.0 : mincld;
+
+      d.qv_prev(i,k) = d.qv(i,k);
+      d.t_prev(i,k) = T;
+
+      // Hydrostatic layer thickness
+      d.dz(i,k) = consts::RD*T/(consts::gravit*d.pres(i,k))*d.dpres(i,k);
+    }
+  }
+
+  return dp;
+}
+
 FortranData::Ptr Factory::create (IC ic, Int ncol, Int nlev) {
  switch (ic) {
    case mixed: return make_mixed(ncol, nlev);
+   case regimes: return make_regimes(ncol, nlev);
  default:
    EKAT_REQUIRE_MSG(false, "Not an IC: " << ic);
  }
@@ -9,8 +9,11 @@ namespace ic {
 
 FortranData::Ptr make_mixed(Int ncol);
 
+// Columns sampled from a mix of regimes (see physics_ic_regimes.hpp)
+FortranData::Ptr make_regimes(Int ncol, Int nlev, unsigned seed = 0);
+
 struct Factory {
-  enum IC { mixed };
+  enum IC { mixed, regimes };
 
   static FortranData::Ptr create(IC ic, Int ncol = 1, Int nlev = 72);
 };
@@ -455,13 +455,18 @@ void Functions<S,D>
         lookup_rain(qr_incld(k), nr_incld(k), table_rain, qi_gt_small);
 
         // call to lookup table interpolation subroutines to get process rates
-        table_val_qi_fallspd.set(qi_gt_small, apply_table_ice(1, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_self_collect.set(qi_gt_small, apply_table_ice(2, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qc2qi_collect.set(qi_gt_small, apply_table_ice(3, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qi2qr_melting.set(qi_gt_small, apply_table_ice(4, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_lammax.set(qi_gt_small, apply_table_ice(6, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_lammin.set(qi_gt_small, apply_table_ice(7, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qi2qr_vent_melt.set(qi_gt_small, apply_table_ice(9, ice_table_vals, table_ice, qi_gt_small));
+        {
+          const Int idx[7] = {1, 2, 3, 4, 6, 7, 9};
+          Spack proc[7];
+          apply_table_ice(idx, ice_table_vals, table_ice, proc, qi_gt_small);
+          table_val_qi_fallspd.set(qi_gt_small, proc[0]);
+          table_val_ni_self_collect.set(qi_gt_small, proc[1]);
+          table_val_qc2qi_collect.set(qi_gt_small, proc[2]);
+          table_val_qi2qr_melting.set(qi_gt_small, proc[3]);
+          table_val_ni_lammax.set(qi_gt_small, proc[4]);
+          table_val_ni_lammin.set(qi_gt_small, proc[5]);
+          table_val_qi2qr_vent_melt.set(qi_gt_small, proc[6]);
+        }
 
         // ice-rain collection processes
         const auto qr_gt_small = qr_incld(k) >= qsmall && qi_gt_small;
@@ -862,13 +867,18 @@ void Functions<S,D>
       TableIce table_ice;
       lookup_ice(qi_incld, ni_incld, qm_incld, rhop, table_ice, qi_gt_small);
 
-      table_val_qi_fallspd.set(qi_gt_small, apply_table_ice(1,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_eff_radius.set(qi_gt_small, apply_table_ice(5,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ni_lammax.set(qi_gt_small, apply_table_ice(6,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ni_lammin.set(qi_gt_small, apply_table_ice(7,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_reflectivity.set(qi_gt_small, apply_table_ice(8,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_mean_diam.set(qi_gt_small, apply_table_ice(10, ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_bulk_dens.set(qi_gt_small, apply_table_ice(11, ice_table_vals, table_ice, qi_gt_small));
+      {
+        const Int idx[7] = {1, 5, 6, 7, 8, 10, 11};
+        Spack proc[7];
+        apply_table_ice(idx, ice_table_vals, table_ice, proc, qi_gt_small);
+        table_val_qi_fallspd.set(qi_gt_small, proc[0]);
+        table_val_ice_eff_radius.set(qi_gt_small, proc[1]);
+        table_val_ni_lammax.set(qi_gt_small, proc[2]);
+        table_val_ni_lammin.set(qi_gt_small, proc[3]);
+        table_val_ice_reflectivity.set(qi_gt_small, proc[4]);
+        table_val_ice_mean_diam.set(qi_gt_small, proc[5]);
+        table_val_ice_bulk_dens.set(qi_gt_small, proc[6]);
+      }
 
       // impose mean ice size bounds (i.e. apply lambda limiters)
       // note that the Nmax and Nmin are normalized and thus need to be multiplied by existing N
@@ -927,12 +937,31 @@ Int Functions<S,D>
 {
   using ExeSpace = typename KT::ExeSpace;
 
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+
+  return p3_main(prognostic_state, diagnostic_inputs, diagnostic_outputs, infrastructure,
+                 history_only, policy, workspace_mgr, nj, nk);
+}
+
+template <typename S, typename D>
+Int Functions<S,D>
+::p3_main(
+  const P3PrognosticState& prognostic_state,
+  const P3DiagnosticInputs& diagnostic_inputs,
+  const P3DiagnosticOutputs& diagnostic_outputs,
+  const P3Infrastructure& infrastructure,
+  const P3HistoryOnly& history_only,
+  const TeamPolicy& policy,
+  const WorkspaceManager& workspace_mgr,
+  Int nj,
+  Int nk)
+{
   view_2d<Spack> latent_heat_sublim("latent_heat_sublim", nj, nk), latent_heat_vapor("latent_heat_vapor", nj, nk), latent_heat_fusion("latent_heat_fusion", nj, nk);
 
   get_latent_heat(nj, nk, latent_heat_vapor, latent_heat_sublim, latent_heat_fusion);
 
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
 
   // load constants into local vars
   const     Scalar inv_dt          = 1 / infrastructure.dt;
@@ -1124,19 +1153,19 @@ Int Functions<S,D>
       oqc, onc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
       diagnostic_outputs.precip_liq_surf(i));
 
-    // Rain sedimentation:  (adaptive substepping)
+    // Rain sedimentation:  (adaptive substepping, or implicit)
     rain_sedimentation(
       rho, inv_rho, rhofacr, ocld_frac_r, inv_dz, qr_incld, team, workspace,
       vn_table_vals, vm_table_vals, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, oqr,
       onr, nr_incld, mu_r, lamr, oprecip_liq_flux, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf(i));
+      diagnostic_outputs.precip_liq_surf(i), infrastructure.implicitSed);
 
-    // Ice sedimentation:  (adaptive substepping)
+    // Ice sedimentation:  (adaptive substepping, or implicit)
     ice_sedimentation(
       rho, inv_rho, rhofaci, ocld_frac_i, inv_dz, team, workspace, nk, ktop, kbot,
       kdir, infrastructure.dt, inv_dt, oqi, qi_incld, oni, ni_incld,
       oqm, qm_incld, obm, bm_incld, qtend_ignore, ntend_ignore,
-      ice_table_vals, diagnostic_outputs.precip_ice_surf(i));
+      ice_table_vals, diagnostic_outputs.precip_ice_surf(i), infrastructure.implicitSed);
 
     // homogeneous freezing of cloud and rain
     homogeneous_freezing(
@@ -11,5 +11,13 @@ namespace p3 {
 
 template struct Functions<Real,DefaultDevice>;
 
+#define ETI_TABLE_ICE(N)                                                \
+  template void Functions<Real,DefaultDevice>                           \
+  ::apply_table_ice<N>(const Int (&idx)[N], const view_ice_table& ice_table_vals, \
+                       const TableIce& tab, Spack (&proc)[N], const Smask& context);
+ETI_TABLE_ICE(4)
+ETI_TABLE_ICE(7)
+#undef ETI_TABLE_ICE
+
 } // namespace p3
 } // namespace scream
@@ -216,6 +216,54 @@ typename Functions<S,D>::Spack Functions<S,D>
   return proc;
 }
 
+template <typename S, typename D>
+template <int N>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_ice(const Int (&idx)[N], const view_ice_table& ice_table_vals, const TableIce& tab,
+                  Spack (&proc)[N], const Smask& context)
+{
+  if (!context.any()) return;
+
+  // The interpolation below performs the same operations, in the same order,
+  // as the single-process apply_table_ice, so results are BFB with it.
+  ekat_masked_loop(context, s) {
+    const Int jj = tab.dumjj[s];
+    const Int ii = tab.dumii[s];
+    const Int i  = tab.dumi[s];
+
+    const Scalar w1 = tab.dum1[s] - Scalar(i)  - 1;
+    const Scalar w4 = tab.dum4[s] - Scalar(ii) - 1;
+    const Scalar w5 = tab.dum5[s] - Scalar(jj) - 1;
+
+    // Stencil nodes, named after their (density, rime fraction, size) offsets
+    const Scalar* n000 = &ice_table_vals(jj,   ii,   i,   0);
+    const Scalar* n001 = &ice_table_vals(jj,   ii,   i+1, 0);
+    const Scalar* n010 = &ice_table_vals(jj,   ii+1, i,   0);
+    const Scalar* n011 = &ice_table_vals(jj,   ii+1, i+1, 0);
+    const Scalar* n100 = &ice_table_vals(jj+1, ii,   i,   0);
+    const Scalar* n101 = &ice_table_vals(jj+1, ii,   i+1, 0);
+    const Scalar* n110 = &ice_table_vals(jj+1, ii+1, i,   0);
+    const Scalar* n111 = &ice_table_vals(jj+1, ii+1, i+1, 0);
+
+    for (int n = 0; n < N; ++n) {
+      const Int p = idx[n];
+
+      // value at current density index
+      Scalar iproc1 = n000[p] + w1 * (n001[p] - n000[p]);
+      Scalar gproc1 = n010[p] + w1 * (n011[p] - n010[p]);
+      const Scalar tmp1 = iproc1 + w4 * (gproc1 - iproc1);
+
+      // value at density index + 1
+      iproc1 = n100[p] + w1 * (n101[p] - n100[p]);
+      gproc1 = n110[p] + w1 * (n111[p] - n110[p]);
+      const Scalar tmp2 = iproc1 + w4 * (gproc1 - iproc1);
+
+      proc[n][s] = tmp1 + w5 * (tmp2 - tmp1);
+    }
+  }
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 typename Functions<S,D>::Spack Functions<S,D>
@@ -43,6 +43,23 @@ ETI_GENSED(2)
 ETI_GENSED(4)
 #undef ETI_GENSED
 
+#define ETI_IMPSED(nfield)                                              \
+  template void Functions<Real,DefaultDevice>                           \
+  ::implicit_sedimentation<nfield>(                                     \
+    const uview_1d<const Spack>& rho,                                   \
+    const uview_1d<const Spack>& inv_rho,                               \
+    const uview_1d<const Spack>& inv_dz,                               \
+    const MemberType& team,                                             \
+    const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, \
+    Scalar& dt_left, Scalar& prt_accum,                                 \
+    const view_1d_ptr_array<Spack, nfield>& flux,                       \
+    const view_1d_ptr_array<Spack, nfield>& V,                          \
+    const view_1d_ptr_array<Spack, nfield>& r);
+ETI_IMPSED(1)
+ETI_IMPSED(2)
+ETI_IMPSED(4)
+#undef ETI_IMPSED
+
 template struct Functions<Real,DefaultDevice>;
 
 } // namespace p3
@@ -127,6 +127,59 @@ void Functions<S,D>
   dt_left -= dt_sub;
 }
 
+template <typename S, typename D>
+template <int nfield>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::implicit_sedimentation (
+  const uview_1d<const Spack>& rho,
+  const uview_1d<const Spack>& inv_rho,
+  const uview_1d<const Spack>& inv_dz,
+  const MemberType& team,
+  const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, Scalar& dt_left, Scalar& prt_accum,
+  const view_1d_ptr_array<Spack, nfield>& fluxes,
+  const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+  const view_1d_ptr_array<Spack, nfield>& rs)
+{
+  const Scalar dt = dt_left;
+  const auto srho     = scalarize(rho);
+  const auto sinv_rho = scalarize(inv_rho);
+  const auto sinv_dz  = scalarize(inv_dz);
+
+  // Backward Euler upwind: the flux out of cell k uses the end-of-step value,
+  //   r_new(k) = (r(k) + dt/(rho*dz)*flux_in) / (1 + dt*V(k)/dz),
+  // so the top-down sweep is a recurrence, done by one thread per column.
+  Kokkos::single(
+    Kokkos::PerTeam(team), [&] () {
+      for (int f = 0; f < nfield; ++f) {
+        const auto sflux = scalarize(*fluxes[f]);
+        const auto sV    = scalarize(*Vs[f]);
+        const auto sr    = scalarize(*rs[f]);
+
+        Scalar flux_in = 0, V_in = 0;
+        for (Int k = k_qxtop; k != kbot - kdir; k -= kdir) {
+          // Cells that were empty have no fall speed: let the incoming
+          // mass keep falling at the speed it had in the cell above.
+          const Scalar V = (sV(k) > 0 || flux_in == 0) ? sV(k) : V_in;
+          const Scalar dt_dz = dt * sinv_dz(k);
+          sr(k) = (sr(k) + dt_dz * sinv_rho(k) * flux_in) / (1 + dt_dz * V);
+          flux_in  = V * srho(k) * sr(k);
+          sflux(k) = flux_in;
+          V_in = V;
+        }
+      }
+    });
+  team.team_barrier();
+
+  // accumulated precip during time step
+  const auto sflux0 = scalarize(*fluxes[0]);
+  prt_accum += sflux0(kbot) * dt;
+
+  // mass may now be anywhere down to the surface, and no time is left
+  k_qxbot = kbot;
+  dt_left = 0;
+}
+
 template <typename S, typename D>
 template <int nfield>
 KOKKOS_FUNCTION
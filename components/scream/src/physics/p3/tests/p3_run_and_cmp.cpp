@@ -93,7 +93,8 @@ static Int compare (const std::string& label, const Scalar* a,
 }
 
 struct Baseline {
-  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN)
+  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN,
+            const ic::Factory::IC ic)
   {
     //If predict_nc="both", start looping at i_start=0 (false) and end after i_start=1 (true)
     //otherwise, modify start and end to only loop over case of interest. Test that predict_nc
@@ -113,7 +114,7 @@ struct Baseline {
     for (int i = i_start; i < i_end; ++i) { // predict_nc is false or true
       for (int j = j_start; j< j_end; ++j) { //prescribed_CCN is false or true
 	//                 initial condit,     repeat, nsteps, ncol, nlev, dt, prescribe or predict nc, prescribe CCN or not
-	params_.push_back({ic::Factory::mixed, repeat, nsteps, ncol, nlev, dt, i>0,                     j>0 });
+	params_.push_back({ic,                 repeat, nsteps, ncol, nlev, dt, i>0,                     j>0 });
       }
     }
   }
@@ -268,7 +269,8 @@ int main (int argc, char** argv) {
       "  -k <nlev>           Number of vertical levels. Default=72.\n"
       "  -r <repeat>         Number of repetitions, implies timing run (generate + no I/O). Default=0.\n"
       "  -p <predict_nc>     yes|no|both. Default=both.\n"
-      "  -c <prescribed_ccn> yes|no|both. Default=both.\n";
+      "  -c <prescribed_ccn> yes|no|both. Default=both.\n"
+      "  -ic <ic>            Initial condition: mixed|regimes. Default=mixed.\n";
     return 1;
   }
 
@@ -281,6 +283,7 @@ int main (int argc, char** argv) {
   Int repeat = 0;
   std::string predict_nc = "both";
   std::string prescribed_ccn = "both";
+  ic::Factory::IC ic = ic::Factory::mixed;
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
     if (ekat::argv_matches(argv[i], "-f", "--fortran")) use_fortran = true;
@@ -331,6 +334,14 @@ int main (int argc, char** argv) {
       EKAT_REQUIRE_MSG(prescribed_ccn == "yes" || prescribed_ccn == "no" || prescribed_ccn == "both",
                        "Prescribed CCN option value must be one of yes|no|both");
     }
+    if (ekat::argv_matches(argv[i], "-ic", "--ic")) {
+      expect_another_arg(i, argc);
+      ++i;
+      const std::string ic_name(argv[i]);
+      EKAT_REQUIRE_MSG(ic_name == "mixed" || ic_name == "regimes",
+                       "Initial condition must be one of mixed|regimes");
+      ic = ic_name == "mixed" ? ic::Factory::mixed : ic::Factory::regimes;
+    }
   }
 
   // Decorate baseline name with precision.
@@ -338,7 +349,7 @@ int main (int argc, char** argv) {
   baseline_fn += std::to_string(sizeof(scream::Real));
 
   scream::initialize_scream_session(argc, argv); {
-    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn);
+    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn, ic);
     if (generate) {
       std::cout << "Generating to " << baseline_fn << "\n";
       nerr += bln.generate_baseline(baseline_fn, use_fortran);
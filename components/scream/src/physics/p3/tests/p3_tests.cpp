@@ -1,6 +1,8 @@
 #include "catch2/catch.hpp"
 #include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_functions_f90.hpp"
 #include "physics/p3/p3_ic_cases.hpp"
+#include "physics/share/physics_ic_regimes.hpp"
 
 namespace {
 
@@ -38,4 +40,51 @@ TEST_CASE("p3_ic_c", "p3") {
   REQUIRE(nerr == 0);
 }
 
+TEST_CASE("p3_ic_regimes", "p3") {
+  using scream::p3::ic::Factory;
+  using scream::physics::Regime;
+
+  const int ncol = 16;
+  const auto regimes = scream::physics::sample_column_regimes(ncol);
+  const auto d = Factory::create(Factory::regimes, ncol);
+
+  // The sampling must be reproducible
+  const auto regimes2 = scream::physics::sample_column_regimes(ncol);
+  for (int i = 0; i < ncol; ++i) {
+    REQUIRE(regimes[i].regime == regimes2[i].regime);
+    REQUIRE(regimes[i].strength == regimes2[i].strength);
+  }
+
+  for (int i = 0; i < ncol; ++i) {
+    bool has_qc = false, has_qr = false, has_qi = false;
+    for (int k = 0; k < d->nlev; ++k) {
+      has_qc = has_qc || d->qc(i,k) > 0;
+      has_qr = has_qr || d->qr(i,k) > 0;
+      has_qi = has_qi || d->qi(i,k) > 0;
+      REQUIRE(d->qv(i,k) >= 0);
+      REQUIRE(d->dz(i,k) > 0);
+    }
+    switch (regimes[i].regime) {
+      case Regime::ClearSky:
+        REQUIRE((not has_qc and not has_qr and not has_qi));
+        break;
+      case Regime::Stratocumulus:
+        REQUIRE((has_qc and not has_qi));
+        break;
+      case Regime::DeepConvection:
+        REQUIRE((has_qc and has_qr and has_qi));
+        break;
+      case Regime::PolarIce:
+        REQUIRE((has_qi and not has_qr));
+        break;
+    }
+  }
+
+  // Make sure P3 can run on it
+  d->dt = 300.0;
+  scream::p3::p3_init();
+  scream::p3::p3_main(*d, false);
+  scream::p3::P3GlobalForFortran::deinit();
+}
+
 } // empty namespace
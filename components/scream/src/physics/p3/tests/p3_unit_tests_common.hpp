@@ -66,6 +66,7 @@ struct UnitWrap {
     struct TestFind;
     struct TestUpwind;
     struct TestGenSed;
+    struct TestImplicitSed;
     struct TestP3Saturation;
     struct TestDsd2;
     struct TestP3Conservation;
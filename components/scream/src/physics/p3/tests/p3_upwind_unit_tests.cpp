@@ -344,6 +344,123 @@ static void run_bfb()
 
 };
 
+// The implicit scheme is run with time steps far beyond the explicit CFL
+// limit. Each step must conserve the mass of each field, including what
+// leaves through the bottom boundary, and keep the mixing ratios nonnegative.
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestImplicitSed {
+
+static void run_phys()
+{
+  using ekat::repack;
+  constexpr auto SPS = SCREAM_SMALL_PACK_SIZE;
+
+  static const Int nfield = 2;
+
+  const auto eps = std::numeric_limits<Scalar>::epsilon();
+
+  Int nerr = 0;
+  for (Int nk : {17, 32, 77, 128}) {
+    const Int npack = (nk + Pack::n - 1) / Pack::n, kmin = 0, kmax = nk - 1;
+    const Real max_speed = 4.2, min_dz = 0.33;
+    const Real dt = 50*min_dz/max_speed;
+
+    view_1d<Pack> rho("rho", npack), inv_rho("inv_rho", npack), inv_dz("inv_dz", npack);
+    const auto lrho = repack<SPS>(rho), linv_rho = repack<SPS>(inv_rho), linv_dz = repack<SPS>(inv_dz);
+
+    Kokkos::Array<view_1d<Pack>, nfield> flux, V, r;
+    Kokkos::Array<uview_1d<Spack>, nfield> lflux, lV, lr;
+    for (int i = 0; i < nfield; ++i) {
+      flux[i] = view_1d<Pack>("flux", npack);
+      V[i]    = view_1d<Pack>("V", npack);
+      r[i]    = view_1d<Pack>("r", npack);
+      lflux[i] = repack<SPS>(flux[i]);
+      lV[i]    = repack<SPS>(V[i]);
+      lr[i]    = repack<SPS>(r[i]);
+    }
+
+    for (Int kdir : {-1, 1}) {
+      const Int kbot  = kdir == 1 ? kmin : kmax;
+      const Int k_top = kdir == 1 ? kmax : kmin;
+
+      // Set rho, dz, fall speeds, and mixing ratios. Field 1 starts empty near
+      // the boundaries, and has no fall speed where it is empty.
+      const auto init_fields = KOKKOS_LAMBDA (const MemberType& team) {
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, npack), [&] (const Int& k) {
+          const auto range = ekat::range<Pack>(k*Pack::n);
+          const auto mask = range >= 2 && range < nk-2;
+          rho(k) = 1 + range/nk;
+          inv_rho(k) = 1 / rho(k);
+          inv_dz(k) = 1 / (min_dz + range*range / (nk*nk));
+          V[0](k) = 0.5*(1 + range/nk) * max_speed;
+          r[0](k) = 1;
+          V[1](k) = 0;
+          r[1](k) = 0;
+          V[1](k).set(mask, max_speed * range/nk);
+          r[1](k).set(mask, range/nk);
+        });
+      };
+      Kokkos::parallel_for(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                           init_fields);
+
+      for (Int time_step = 0; time_step < 4; ++time_step) {
+        const auto step = KOKKOS_LAMBDA (const MemberType& team, Int& nerr) {
+          const auto srho = scalarize(rho), sinv_dz = scalarize(inv_dz);
+
+          const auto total_mass = [&] (const Int& f) {
+            const auto sr = scalarize(r[f]);
+            Scalar mass = 0;
+            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nk), [&] (const Int& k, Scalar& lmass) {
+              lmass += srho(k)*sr(k)/sinv_dz(k);
+            }, mass);
+            return mass;
+          };
+
+          Scalar mass0[nfield];
+          for (Int f = 0; f < nfield; ++f) mass0[f] = total_mass(f);
+          team.team_barrier();
+
+          Int k_qxbot = k_top;
+          Scalar dt_left = dt, prt_accum = 0;
+          Functions::template implicit_sedimentation<nfield>(
+            lrho, linv_rho, linv_dz, team, nk, k_top, k_qxbot, kbot, kdir, dt_left, prt_accum,
+            {&lflux[0], &lflux[1]}, {&lV[0], &lV[1]}, {&lr[0], &lr[1]});
+          team.team_barrier();
+
+          if (dt_left != 0 || k_qxbot != kbot) ++nerr;
+
+          // Check conservation, with the mass that left through the bottom.
+          // prt_accum accounts for field 0.
+          for (Int f = 0; f < nfield; ++f) {
+            const auto sflux = scalarize(flux[f]);
+            const Scalar out = f == 0 ? prt_accum : sflux(kbot)*dt;
+            const Scalar mass1 = total_mass(f) + out;
+            if (ekat::impl::rel_diff(mass0[f], mass1) > 1e3*eps) ++nerr;
+          }
+
+          // Check for nonnegative mixing ratios.
+          for (Int f = 0; f < nfield; ++f) {
+            const auto sr = scalarize(r[f]);
+            Int lnerr = 0;
+            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, nk), [&] (const Int& k, Int& ln) {
+              if (sr(k) < 0) ++ln;
+            }, lnerr);
+            nerr += lnerr;
+          }
+        };
+        Int lnerr;
+        Kokkos::parallel_reduce(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                                step, lnerr);
+        nerr += lnerr;
+        Kokkos::fence();
+        REQUIRE(nerr == 0);
+      }
+    }
+  }
+}
+
+};
+
 }
 }
 }
@@ -366,4 +483,11 @@ TEST_CASE("p3_gen_sed", "[p3_functions]")
   TG::run_bfb();
 }
 
+TEST_CASE("p3_implicit_sed", "[p3_functions]")
+{
+  using TI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestImplicitSed;
+
+  TI::run_phys();
+}
+
 } // namespace
@@ -5,6 +5,7 @@
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #include "YAKL/YAKL.h"
 #include "ekat/ekat_assert.hpp"
+#include "ekat/util/ekat_math_utils.hpp"
 
 namespace scream {
 
@@ -48,6 +49,13 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   m_lat  = grid->get_geometry_data("lat");
   m_lon  = grid->get_geometry_data("lon");
 
+  // Optionally, run RRTMGP on blocks of columns
+  m_col_chunk_size = m_ncol;
+  if (m_rrtmgp_params.isParameter("column_chunk_size")) {
+    m_col_chunk_size = std::min(m_rrtmgp_params.get<int>("column_chunk_size"), m_ncol);
+  }
+  EKAT_REQUIRE_MSG(m_col_chunk_size>0, "Error! RRTMGP column_chunk_size must be positive.\n");
+
   // Set up dimension layouts
   FieldLayout scalar2d_layout     { {COL   }, {m_ncol    } };
   FieldLayout scalar3d_layout_mid { {COL,LEV}, {m_ncol,m_nlay} };
@@ -90,10 +98,11 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
 
 int RRTMGPRadiation::requested_buffer_size_in_bytes() const
 {
-  const int interface_request = Buffer::num_1d_ncol*m_ncol*sizeof(Real) +
-                                Buffer::num_2d_nlay*m_ncol*m_nlay*sizeof(Real) +
-                                Buffer::num_2d_nlay_p1*m_ncol*(m_nlay+1)*sizeof(Real) +
-                                Buffer::num_2d_nswbands*m_ncol*m_nswbands*sizeof(Real);
+  // Buffers are sized for one block of columns
+  const int interface_request = Buffer::num_1d_ncol*m_col_chunk_size*sizeof(Real) +
+                                Buffer::num_2d_nlay*m_col_chunk_size*m_nlay*sizeof(Real) +
+                                Buffer::num_2d_nlay_p1*m_col_chunk_size*(m_nlay+1)*sizeof(Real) +
+                                Buffer::num_2d_nswbands*m_col_chunk_size*m_nswbands*sizeof(Real);
 
   return interface_request;
 } // RRTMGPRadiation::requested_buffer_size
@@ -103,59 +112,60 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(buffer_manager.allocated_bytes() >= requested_buffer_size_in_bytes(), "Error! Buffers size not sufficient.\n");
 
   Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
+  const int ncol = m_col_chunk_size;
 
   // 1d array
-  m_buffer.mu0 = decltype(m_buffer.mu0)("mu0", mem, m_ncol);
+  m_buffer.mu0 = decltype(m_buffer.mu0)("mu0", mem, ncol);
   mem += m_buffer.mu0.totElems();
 
   // 2d arrays
-  m_buffer.p_lay = decltype(m_buffer.p_lay)("p_lay", mem, m_ncol, m_nlay);
+  m_buffer.p_lay = decltype(m_buffer.p_lay)("p_lay", mem, ncol, m_nlay);
   mem += m_buffer.p_lay.totElems();
-  m_buffer.t_lay = decltype(m_buffer.t_lay)("t_lay", mem, m_ncol, m_nlay);
+  m_buffer.t_lay = decltype(m_buffer.t_lay)("t_lay", mem, ncol, m_nlay);
   mem += m_buffer.t_lay.totElems();
-  m_buffer.p_del = decltype(m_buffer.p_del)("p_del", mem, m_ncol, m_nlay);
+  m_buffer.p_del = decltype(m_buffer.p_del)("p_del", mem, ncol, m_nlay);
   mem += m_buffer.p_del.totElems();
-  m_buffer.qc = decltype(m_buffer.qc)("qc", mem, m_ncol, m_nlay);
+  m_buffer.qc = decltype(m_buffer.qc)("qc", mem, ncol, m_nlay);
   mem += m_buffer.qc.totElems();
-  m_buffer.qi = decltype(m_buffer.qi)("qi", mem, m_ncol, m_nlay);
+  m_buffer.qi = decltype(m_buffer.qi)("qi", mem, ncol, m_nlay);
   mem += m_buffer.qi.totElems();
-  m_buffer.cldfrac_tot = decltype(m_buffer.cldfrac_tot)("cldfrac_tot", mem, m_ncol, m_nlay);
+  m_buffer.cldfrac_tot = decltype(m_buffer.cldfrac_tot)("cldfrac_tot", mem, ncol, m_nlay);
   mem += m_buffer.cldfrac_tot.totElems();
-  m_buffer.eff_radius_qc = decltype(m_buffer.eff_radius_qc)("eff_radius_qc", mem, m_ncol, m_nlay);
+  m_buffer.eff_radius_qc = decltype(m_buffer.eff_radius_qc)("eff_radius_qc", mem, ncol, m_nlay);
   mem += m_buffer.eff_radius_qc.totElems();
-  m_buffer.eff_radius_qi = decltype(m_buffer.eff_radius_qi)("eff_radius_qi", mem, m_ncol, m_nlay);
+  m_buffer.eff_radius_qi = decltype(m_buffer.eff_radius_qi)("eff_radius_qi", mem, ncol, m_nlay);
   mem += m_buffer.eff_radius_qi.totElems();
-  m_buffer.tmp2d = decltype(m_buffer.tmp2d)("tmp2d", mem, m_ncol, m_nlay);
+  m_buffer.tmp2d = decltype(m_buffer.tmp2d)("tmp2d", mem, ncol, m_nlay);
   mem += m_buffer.tmp2d.totElems();
-  m_buffer.lwp = decltype(m_buffer.lwp)("lwp", mem, m_ncol, m_nlay);
+  m_buffer.lwp = decltype(m_buffer.lwp)("lwp", mem, ncol, m_nlay);
   mem += m_buffer.lwp.totElems();
-  m_buffer.iwp = decltype(m_buffer.iwp)("iwp", mem, m_ncol, m_nlay);
+  m_buffer.iwp = decltype(m_buffer.iwp)("iwp", mem, ncol, m_nlay);
   mem += m_buffer.iwp.totElems();
-  m_buffer.sw_heating = decltype(m_buffer.sw_heating)("sw_heating", mem, m_ncol, m_nlay);
+  m_buffer.sw_heating = decltype(m_buffer.sw_heating)("sw_heating", mem, ncol, m_nlay);
   mem += m_buffer.sw_heating.totElems();
-  m_buffer.lw_heating = decltype(m_buffer.lw_heating)("lw_heating", mem, m_ncol, m_nlay);
+  m_buffer.lw_heating = decltype(m_buffer.lw_heating)("lw_heating", mem, ncol, m_nlay);
   mem += m_buffer.lw_heating.totElems();
-  m_buffer.rad_heating = decltype(m_buffer.rad_heating)("rad_heating", mem, m_ncol, m_nlay);
+  m_buffer.rad_heating = decltype(m_buffer.rad_heating)("rad_heating", mem, ncol, m_nlay);
   mem += m_buffer.rad_heating.totElems();
 
-  m_buffer.p_lev = decltype(m_buffer.p_lev)("p_lev", mem, m_ncol, m_nlay+1);
+  m_buffer.p_lev = decltype(m_buffer.p_lev)("p_lev", mem, ncol, m_nlay+1);
   mem += m_buffer.p_lev.totElems();
-  m_buffer.t_lev = decltype(m_buffer.t_lev)("t_lev", mem, m_ncol, m_nlay+1);
+  m_buffer.t_lev = decltype(m_buffer.t_lev)("t_lev", mem, ncol, m_nlay+1);
   mem += m_buffer.t_lev.totElems();
-  m_buffer.sw_flux_up = decltype(m_buffer.sw_flux_up)("sw_flux_up", mem, m_ncol, m_nlay+1);
+  m_buffer.sw_flux_up = decltype(m_buffer.sw_flux_up)("sw_flux_up", mem, ncol, m_nlay+1);
   mem += m_buffer.sw_flux_up.totElems();
-  m_buffer.sw_flux_dn = decltype(m_buffer.sw_flux_dn)("sw_flux_dn", mem, m_ncol, m_nlay+1);
+  m_buffer.sw_flux_dn = decltype(m_buffer.sw_flux_dn)("sw_flux_dn", mem, ncol, m_nlay+1);
   mem += m_buffer.sw_flux_dn.totElems();
-  m_buffer.sw_flux_dn_dir = decltype(m_buffer.sw_flux_dn_dir)("sw_flux_dn_dir", mem, m_ncol, m_nlay+1);
+  m_buffer.sw_flux_dn_dir = decltype(m_buffer.sw_flux_dn_dir)("sw_flux_dn_dir", mem, ncol, m_nlay+1);
   mem += m_buffer.sw_flux_dn_dir.totElems();
-  m_buffer.lw_flux_up = decltype(m_buffer.lw_flux_up)("lw_flux_up", mem, m_ncol, m_nlay+1);
+  m_buffer.lw_flux_up = decltype(m_buffer.lw_flux_up)("lw_flux_up", mem, ncol, m_nlay+1);
   mem += m_buffer.lw_flux_up.totElems();
-  m_buffer.lw_flux_dn = decltype(m_buffer.lw_flux_dn)("lw_flux_dn", mem, m_ncol, m_nlay+1);
+  m_buffer.lw_flux_dn = decltype(m_buffer.lw_flux_dn)("lw_flux_dn", mem, ncol, m_nlay+1);
   mem += m_buffer.lw_flux_dn.totElems();
 
-  m_buffer.sfc_alb_dir = decltype(m_buffer.sfc_alb_dir)("surf_alb_direct", mem, m_ncol, m_nswbands);
+  m_buffer.sfc_alb_dir = decltype(m_buffer.sfc_alb_dir)("surf_alb_direct", mem, ncol, m_nswbands);
   mem += m_buffer.sfc_alb_dir.totElems();
-  m_buffer.sfc_alb_dif = decltype(m_buffer.sfc_alb_dif)("surf_alb_diffuse", mem, m_ncol, m_nswbands);
+  m_buffer.sfc_alb_dif = decltype(m_buffer.sfc_alb_dif)("surf_alb_diffuse", mem, ncol, m_nswbands);
   mem += m_buffer.sfc_alb_dif.totElems();
 
   int used_mem = (reinterpret_cast<Real*>(mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -175,8 +185,9 @@ void RRTMGPRadiation::initialize_impl(const util::TimeStamp& /* t0 */) {
     gas_mol_w_host[igas]            = PC::get_gas_mol_weight(m_gas_names[igas]);
   }
   Kokkos::deep_copy(m_gas_mol_weights,gas_mol_w_host);
-  // Initialize GasConcs object to pass to RRTMGP initializer;
-  gas_concs.init(gas_names_yakl_offset,m_ncol,m_nlay);
+  // Initialize GasConcs object to pass to RRTMGP initializer; like the other
+  // buffers, it is sized for one block of columns
+  gas_concs.init(gas_names_yakl_offset,m_col_chunk_size,m_nlay);
   rrtmgp::rrtmgp_initialize(gas_concs);
 
 }
@@ -225,124 +236,144 @@ void RRTMGPRadiation::run_impl (const Real dt) {
   auto lw_flux_up     = m_buffer.lw_flux_up;
   auto lw_flux_dn     = m_buffer.lw_flux_dn;
 
-  // Copy data from the FieldManager to the YAKL arrays
-  {
-    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-      const int i = team.league_rank();
-
-      mu0(i+1) = d_mu0(i);
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m_nlay), [&] (const int& k) {
-        p_lay(i+1,k+1)       = d_pmid(i,k);
-        t_lay(i+1,k+1)       = d_tmid(i,k);
-        p_del(i+1,k+1)       = d_pdel(i,k);
-        qc(i+1,k+1)          = d_qc(i,k);
-        qi(i+1,k+1)          = d_qi(i,k);
-        cldfrac_tot(i+1,k+1) = d_cldfrac_tot(i,k);
-        rel(i+1,k+1)         = d_rel(i,k);
-        rei(i+1,k+1)         = d_rei(i,k);
-        p_lev(i+1,k+1)       = d_pint(i,k);
-        t_lev(i+1,k+1)       = d_tint(i,k);
+  // RRTMGP is run on blocks of m_col_chunk_size columns, reusing the same
+  // buffers. If the last block is not full, it is padded with copies of the
+  // last column, so that all the arrays (and the work arrays RRTMGP keeps
+  // between calls) have the same size for all blocks. Padded columns are
+  // not copied back to the FieldManager.
+  const int ncol  = m_col_chunk_size;
+  const int nlay  = m_nlay;
+  const int nswbands = m_nswbands;
+  const int last_col = m_ncol-1;
+  const int num_chunks = (m_ncol + ncol - 1) / ncol;
+  for (int ic=0; ic<num_chunks; ++ic) {
+    const int beg = ic*ncol;
+    const int ncol_chunk = std::min(ncol, m_ncol-beg);
+
+    // Copy data from the FieldManager to the YAKL arrays
+    {
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlay);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const int i = team.league_rank();
+        const int icol = ekat::impl::min(beg+i,last_col);
+
+        mu0(i+1) = d_mu0(icol);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlay), [&] (const int& k) {
+          p_lay(i+1,k+1)       = d_pmid(icol,k);
+          t_lay(i+1,k+1)       = d_tmid(icol,k);
+          p_del(i+1,k+1)       = d_pdel(icol,k);
+          qc(i+1,k+1)          = d_qc(icol,k);
+          qi(i+1,k+1)          = d_qi(icol,k);
+          cldfrac_tot(i+1,k+1) = d_cldfrac_tot(icol,k);
+          rel(i+1,k+1)         = d_rel(icol,k);
+          rei(i+1,k+1)         = d_rei(icol,k);
+          p_lev(i+1,k+1)       = d_pint(icol,k);
+          t_lev(i+1,k+1)       = d_tint(icol,k);
+        });
+
+        p_lev(i+1,nlay+1) = d_pint(icol,nlay);
+        t_lev(i+1,nlay+1) = d_tint(icol,nlay);
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nswbands), [&] (const int& k) {
+          sfc_alb_dir(i+1,k+1) = d_sfc_alb_dir(icol,k);
+          sfc_alb_dif(i+1,k+1) = d_sfc_alb_dif(icol,k);
+        });
       });
+    }
+    Kokkos::fence();
 
-      p_lev(i+1,m_nlay+1) = d_pint(i,m_nlay);
-      t_lev(i+1,m_nlay+1) = d_tint(i,m_nlay);
-
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m_nswbands), [&] (const int& k) {
-        sfc_alb_dir(i+1,k+1) = d_sfc_alb_dir(i,k);
-        sfc_alb_dif(i+1,k+1) = d_sfc_alb_dif(i,k);
+    // Populate GasConcs object to pass to RRTMGP driver
+    auto tmp2d = m_buffer.tmp2d;
+    for (int igas = 0; igas < m_ngas; igas++) {
+      auto name = m_gas_names[igas];
+      auto fm_name = name=="h2o" ? "qv" : name;
+      auto d_temp  = m_rrtmgp_fields_in.at(fm_name).get_reshaped_view<const Real**>();
+      auto gas_mol_weights = m_gas_mol_weights;
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nlay, ncol);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const int k = team.league_rank();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ncol), [&] (const int& i) {
+          const int icol = ekat::impl::min(beg+i,last_col);
+          tmp2d(i+1,k+1) = PF::calculate_vmr_from_mmr(gas_mol_weights[igas],d_qv(icol,k),d_temp(icol,k)); // Note that for YAKL arrays i and k start with index 1
+        });
       });
-    });
-  }
-  Kokkos::fence();
-
-  // Populate GasConcs object to pass to RRTMGP driver
-  auto tmp2d = m_buffer.tmp2d;
-  for (int igas = 0; igas < m_ngas; igas++) {
-    auto name = m_gas_names[igas];
-    auto fm_name = name=="h2o" ? "qv" : name;
-    auto d_temp  = m_rrtmgp_fields_in.at(fm_name).get_reshaped_view<const Real**>();
-    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_nlay, m_ncol);
+      Kokkos::fence();
+
+      gas_concs.set_vmr(name, tmp2d);
+    }
+
+    // Compute layer cloud mass (per unit area)
+    auto lwp = m_buffer.lwp;
+    auto iwp = m_buffer.iwp;
+    scream::rrtmgp::mixing_ratio_to_cloud_mass(qc, cldfrac_tot, p_del, lwp);
+    scream::rrtmgp::mixing_ratio_to_cloud_mass(qi, cldfrac_tot, p_del, iwp);
+    // Convert to g/m2 (needed by RRTMGP)
+    {
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nlay, ncol);
     Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-      const int k = team.league_rank();
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m_ncol), [&] (const int& i) {
-        tmp2d(i+1,k+1) = PF::calculate_vmr_from_mmr(m_gas_mol_weights[igas],d_qv(i,k),d_temp(i,k)); // Note that for YAKL arrays i and k start with index 1
+      const int k = team.league_rank()+1; // Note that for YAKL arrays i and k start with index 1
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ncol), [&] (const int& icol) {
+        int i = icol+1;
+        lwp(i,k) *= 1e3;
+        iwp(i,k) *= 1e3;
       });
     });
+    }
     Kokkos::fence();
 
-    gas_concs.set_vmr(name, tmp2d);
-  }
-
-  // Compute layer cloud mass (per unit area)
-  auto lwp = m_buffer.lwp;
-  auto iwp = m_buffer.iwp;
-  scream::rrtmgp::mixing_ratio_to_cloud_mass(qc, cldfrac_tot, p_del, lwp);
-  scream::rrtmgp::mixing_ratio_to_cloud_mass(qi, cldfrac_tot, p_del, iwp);
-  // Convert to g/m2 (needed by RRTMGP)
-  {
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_nlay, m_ncol);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-    const int k = team.league_rank()+1; // Note that for YAKL arrays i and k start with index 1
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m_ncol), [&] (const int& icol) {
-      int i = icol+1;
-      lwp(i,k) *= 1e3;
-      iwp(i,k) *= 1e3;
-    });
-  });
-  }
-  Kokkos::fence();
-
-  // Run RRTMGP driver
-  rrtmgp::rrtmgp_main(
-    m_ncol, m_nlay,
-    p_lay, t_lay, p_lev, t_lev,
-    gas_concs,
-    sfc_alb_dir, sfc_alb_dif, mu0,
-    lwp, iwp, rel, rei,
-    sw_flux_up, sw_flux_dn, sw_flux_dn_dir,
-    lw_flux_up, lw_flux_dn
-  );
-
-  // Compute and apply heating rates
-  auto sw_heating  = m_buffer.sw_heating;
-  auto lw_heating  = m_buffer.lw_heating;
-  auto rad_heating = m_buffer.rad_heating;
-  rrtmgp::compute_heating_rate(
-    sw_flux_up, sw_flux_dn, p_del, sw_heating
-  );
-  rrtmgp::compute_heating_rate(
-    lw_flux_up, lw_flux_dn, p_del, lw_heating
-  );
-  {
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_nlay, m_ncol);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-    const int k = team.league_rank()+1; // Note that for YAKL arrays i and k start with index 1
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m_ncol), [&] (const int& icol) {
-      int i = icol+1;
-      rad_heating(i,k) = sw_heating(i,k) + lw_heating(i,k);
-      t_lay(i,k) = t_lay(i,k) + rad_heating(i,k) * dt;
-    });
-  });
-  }
-  Kokkos::fence();
-
-  // Copy ouput data back to FieldManager
-  {
-    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+    // Run RRTMGP driver
+    rrtmgp::rrtmgp_main(
+      ncol, nlay,
+      p_lay, t_lay, p_lev, t_lev,
+      gas_concs,
+      sfc_alb_dir, sfc_alb_dif, mu0,
+      lwp, iwp, rel, rei,
+      sw_flux_up, sw_flux_dn, sw_flux_dn_dir,
+      lw_flux_up, lw_flux_dn
+    );
+
+    // Compute and apply heating rates
+    auto sw_heating  = m_buffer.sw_heating;
+    auto lw_heating  = m_buffer.lw_heating;
+    auto rad_heating = m_buffer.rad_heating;
+    rrtmgp::compute_heating_rate(
+      sw_flux_up, sw_flux_dn, p_del, sw_heating
+    );
+    rrtmgp::compute_heating_rate(
+      lw_flux_up, lw_flux_dn, p_del, lw_heating
+    );
+    {
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nlay, ncol);
     Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
-      const int i = team.league_rank();
-
-      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, m_nlay+1), [&] (const int& k) {
-        if (k < m_nlay) d_tmid(i,k) = t_lay(i+1,k+1);
-
-        d_sw_flux_up(i,k)     = sw_flux_up(i+1,k+1);
-        d_sw_flux_dn(i,k)     = sw_flux_dn(i+1,k+1);
-        d_sw_flux_dn_dir(i,k) = sw_flux_dn_dir(i+1,k+1);
-        d_lw_flux_up(i,k)     = lw_flux_up(i+1,k+1);
-        d_lw_flux_dn(i,k)     = lw_flux_dn(i+1,k+1);
+      const int k = team.league_rank()+1; // Note that for YAKL arrays i and k start with index 1
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, ncol), [&] (const int& icol) {
+        int i = icol+1;
+        rad_heating(i,k) = sw_heating(i,k) + lw_heating(i,k);
+        t_lay(i,k) = t_lay(i,k) + rad_heating(i,k) * dt;
       });
     });
+    }
+    Kokkos::fence();
+
+    // Copy ouput data back to FieldManager (only the columns of this block)
+    {
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol_chunk, nlay);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const int i = team.league_rank();
+        const int icol = beg+i;
+
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlay+1), [&] (const int& k) {
+          if (k < nlay) d_tmid(icol,k) = t_lay(i+1,k+1);
+
+          d_sw_flux_up(icol,k)     = sw_flux_up(i+1,k+1);
+          d_sw_flux_dn(icol,k)     = sw_flux_dn(i+1,k+1);
+          d_sw_flux_dn_dir(icol,k) = sw_flux_dn_dir(i+1,k+1);
+          d_lw_flux_up(icol,k)     = lw_flux_up(i+1,k+1);
+          d_lw_flux_dn(icol,k)     = lw_flux_dn(i+1,k+1);
+        });
+      });
+    }
+    Kokkos::fence();
   }
 }
 
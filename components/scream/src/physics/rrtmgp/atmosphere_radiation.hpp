@@ -80,6 +80,11 @@ public:
   // Keep track of number of columns and levels
   int m_ncol;
   int m_nlay;
+
+  // RRTMGP is run on blocks of (at most) this many columns, so that its
+  // buffers and internal g-point arrays do not scale with m_ncol.
+  // Defaults to m_ncol (i.e., a single block).
+  int m_col_chunk_size;
   view_1d_real m_lat;
   view_1d_real m_lon;
 
@@ -48,6 +48,201 @@ namespace scream {
 
         bool initialized = false;
 
+        /*
+         * Persistent work arrays, so that the radiation call does not need to
+         * allocate (or sync with host) at every step. Plain arrays are flat
+         * buffers sized for ncol columns; the daytime subsets are unmanaged
+         * arrays with the proper (nday,...) dimensions that alias them. The
+         * daytime RRTMGP objects are also allocated for ncol columns, and each
+         * call uses shallow copies of them, whose arrays alias the first nday
+         * columns (see alias_day_columns), so that a change in the number of
+         * daytime columns does not trigger any allocation.
+         */
+        struct RadiationWorkspace {
+            int ncol = -1;
+            int nlay = -1;
+            bool top_at_1;
+
+            // Daytime columns compaction
+            int1d day_indices;
+            int1d block_offsets;
+
+            // Daytime subsets (flat buffers)
+            real1d mu0_day, p_lay_day, t_lay_day, p_lev_day, t_lev_day, vmr_day;
+            real1d sfc_alb_dir_T, sfc_alb_dif_T, toa_flux;
+            real1d flux_up_day, flux_dn_day, flux_dn_dir_day;
+
+            // Full columns arrays
+            real2d vmr;
+            real2d rel_limited, rei_limited;
+            real1d t_sfc;
+            real2d emis_sfc;
+            real2d gauss_Ds, gauss_wts;
+
+            // RRTMGP objects on all columns
+            OpticalProps2str clouds_sw;
+            OpticalProps1scl clouds_lw;
+            OpticalProps1scl optics_lw;
+            SourceFuncLW lw_sources;
+
+            // RRTMGP objects on daytime columns (allocated for ncol columns).
+            // The gas names are only known at the first sw call, so gas_concs_day
+            // is allocated there.
+            bool gas_concs_day_alloc = false;
+            GasConcs gas_concs_day;
+            OpticalProps2str clouds_day;
+            OpticalProps2str optics_sw;
+        };
+        RadiationWorkspace workspace;
+
+        // Block size for the daytime columns compaction
+        constexpr int compaction_block_size = 128;
+
+        /*
+         * Get the workspace, (re)allocating it if the problem size changed.
+         * The vertical ordering (top_at_1) is also computed here, so that
+         * the host does not need to inspect p_lay at every call.
+         */
+        RadiationWorkspace& get_workspace (const int ncol, const int nlay, real2d &p_lay) {
+            auto& ws = workspace;
+            if (ws.ncol==ncol && ws.nlay==nlay) {
+                return ws;
+            }
+
+            ws.ncol = ncol;
+            ws.nlay = nlay;
+            ws.gas_concs_day_alloc = false;
+
+            auto p_lay_host = p_lay.createHostCopy();
+            ws.top_at_1 = p_lay_host(1, 1) < p_lay_host(1, nlay);
+
+            const int nbnd_sw = k_dist_sw.get_nband();
+            const int ngpt_sw = k_dist_sw.get_ngpt();
+            const int nbnd_lw = k_dist_lw.get_nband();
+            const int nblocks = (ncol + compaction_block_size - 1) / compaction_block_size;
+
+            ws.day_indices   = int1d("dayIndices", ncol);
+            ws.block_offsets = int1d("block_offsets", nblocks+1);
+
+            ws.mu0_day         = real1d("mu0_day", ncol);
+            ws.p_lay_day       = real1d("p_lay_day", ncol*nlay);
+            ws.t_lay_day       = real1d("t_lay_day", ncol*nlay);
+            ws.p_lev_day       = real1d("p_lev_day", ncol*(nlay+1));
+            ws.t_lev_day       = real1d("t_lev_day", ncol*(nlay+1));
+            ws.vmr_day         = real1d("vmr_day", ncol*nlay);
+            ws.sfc_alb_dir_T   = real1d("sfc_alb_dir", nbnd_sw*ncol);
+            ws.sfc_alb_dif_T   = real1d("sfc_alb_dif", nbnd_sw*ncol);
+            ws.toa_flux        = real1d("toa_flux", ncol*ngpt_sw);
+            ws.flux_up_day     = real1d("flux_up_day", ncol*(nlay+1));
+            ws.flux_dn_day     = real1d("flux_dn_day", ncol*(nlay+1));
+            ws.flux_dn_dir_day = real1d("flux_dn_dir_day", ncol*(nlay+1));
+
+            ws.vmr         = real2d("vmr", ncol, nlay);
+            ws.rel_limited = real2d("rel_limited", ncol, nlay);
+            ws.rei_limited = real2d("rei_limited", ncol, nlay);
+            ws.t_sfc       = real1d("t_sfc", ncol);
+            ws.emis_sfc    = real2d("emis_sfc", nbnd_lw, ncol);
+
+            ws.clouds_sw = OpticalProps2str();
+            ws.clouds_sw.init(k_dist_sw.get_band_lims_wavenumber());
+            ws.clouds_sw.alloc_2str(ncol, nlay);
+            ws.clouds_lw = OpticalProps1scl();
+            ws.clouds_lw.init(k_dist_lw.get_band_lims_wavenumber());
+            ws.clouds_lw.alloc_1scl(ncol, nlay);
+            ws.optics_lw = OpticalProps1scl();
+            ws.optics_lw.alloc_1scl(ncol, nlay, k_dist_lw);
+            ws.lw_sources = SourceFuncLW();
+            ws.lw_sources.alloc(ncol, nlay, k_dist_lw);
+            ws.clouds_day = OpticalProps2str();
+            ws.clouds_day.init(k_dist_sw.get_band_lims_wavenumber());
+            ws.clouds_day.alloc_2str(ncol, nlay);
+            ws.optics_sw = OpticalProps2str();
+            ws.optics_sw.alloc_2str(ncol, nlay, k_dist_sw);
+
+            // Get Gaussian quadrature weights
+            // TODO: move this crap out of userland!
+            // Weights and angle secants for first order (k=1) Gaussian quadrature.
+            //   Values from Table 2, Clough et al, 1992, doi:10.1029/92JD01419
+            //   after Abramowitz & Stegun 1972, page 921
+            int constexpr max_gauss_pts = 4;
+            realHost2d gauss_Ds_host ("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
+            gauss_Ds_host(1,1) = 1.66_wp      ; gauss_Ds_host(2,1) =         0._wp; gauss_Ds_host(3,1) =         0._wp; gauss_Ds_host(4,1) =         0._wp;
+            gauss_Ds_host(1,2) = 1.18350343_wp; gauss_Ds_host(2,2) = 2.81649655_wp; gauss_Ds_host(3,2) =         0._wp; gauss_Ds_host(4,2) =         0._wp;
+            gauss_Ds_host(1,3) = 1.09719858_wp; gauss_Ds_host(2,3) = 1.69338507_wp; gauss_Ds_host(3,3) = 4.70941630_wp; gauss_Ds_host(4,3) =         0._wp;
+            gauss_Ds_host(1,4) = 1.06056257_wp; gauss_Ds_host(2,4) = 1.38282560_wp; gauss_Ds_host(3,4) = 2.40148179_wp; gauss_Ds_host(4,4) = 7.15513024_wp;
+
+            realHost2d gauss_wts_host("gauss_wts",max_gauss_pts,max_gauss_pts);
+            gauss_wts_host(1,1) = 0.5_wp         ; gauss_wts_host(2,1) = 0._wp          ; gauss_wts_host(3,1) = 0._wp          ; gauss_wts_host(4,1) = 0._wp          ;
+            gauss_wts_host(1,2) = 0.3180413817_wp; gauss_wts_host(2,2) = 0.1819586183_wp; gauss_wts_host(3,2) = 0._wp          ; gauss_wts_host(4,2) = 0._wp          ;
+            gauss_wts_host(1,3) = 0.2009319137_wp; gauss_wts_host(2,3) = 0.2292411064_wp; gauss_wts_host(3,3) = 0.0698269799_wp; gauss_wts_host(4,3) = 0._wp          ;
+            gauss_wts_host(1,4) = 0.1355069134_wp; gauss_wts_host(2,4) = 0.2034645680_wp; gauss_wts_host(3,4) = 0.1298475476_wp; gauss_wts_host(4,4) = 0.0311809710_wp;
+
+            ws.gauss_Ds  = real2d("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
+            ws.gauss_wts = real2d("gauss_wts",max_gauss_pts,max_gauss_pts);
+            gauss_Ds_host .deep_copy_to(ws.gauss_Ds );
+            gauss_wts_host.deep_copy_to(ws.gauss_wts);
+
+            return ws;
+        }
+
+        /*
+         * Shallow copies of workspace RRTMGP objects (allocated for ncol columns),
+         * whose arrays are unmanaged (nday,...) arrays aliasing the first nday
+         * columns. The contents are not preserved: callers overwrite them.
+         */
+        OpticalProps2str alias_day_columns (const OpticalProps2str &props, const int nday) {
+            const int nlay = size(props.tau,2);
+            const int ngpt = size(props.tau,3);
+            OpticalProps2str props_day = props;
+            props_day.tau = real3d("tau", props.tau.data(), nday, nlay, ngpt);
+            props_day.ssa = real3d("ssa", props.ssa.data(), nday, nlay, ngpt);
+            props_day.g   = real3d("g"  , props.g.data()  , nday, nlay, ngpt);
+            return props_day;
+        }
+        GasConcs alias_day_columns (const GasConcs &gas_concs, const int nday) {
+            GasConcs gas_concs_day = gas_concs;
+            gas_concs_day.ncol  = nday;
+            gas_concs_day.concs = real3d("concs", gas_concs.concs.data(), nday, gas_concs.nlay, gas_concs.ngas);
+            return gas_concs_day;
+        }
+
+        /*
+         * Ordered stream compaction of the daytime columns, done on device:
+         * count daytime columns in each block, scan the (few) block counts,
+         * then fill the indices of each block. Only the final count is
+         * copied back to host, since it sets the size of the daytime problem.
+         */
+        int compact_daytime_columns (const int ncol, real1d &mu0, int1d &dayIndices, int1d &block_offsets) {
+            constexpr int bs = compaction_block_size;
+            const int nblocks = (ncol + bs - 1) / bs;
+
+            parallel_for(Bounds<1>(nblocks), YAKL_LAMBDA(int ib) {
+                int count = 0;
+                for (int icol = (ib-1)*bs+1; icol <= min(ib*bs,ncol); icol++) {
+                    if (mu0(icol) > 0) { count++; }
+                }
+                block_offsets(ib+1) = count;
+            });
+            parallel_for(Bounds<1>(1), YAKL_LAMBDA(int i) {
+                block_offsets(1) = 0;
+                for (int ib = 1; ib <= nblocks; ib++) {
+                    block_offsets(ib+1) += block_offsets(ib);
+                }
+            });
+            parallel_for(Bounds<1>(nblocks), YAKL_LAMBDA(int ib) {
+                int iday = block_offsets(ib);
+                for (int icol = (ib-1)*bs+1; icol <= min(ib*bs,ncol); icol++) {
+                    if (mu0(icol) > 0) {
+                        iday++;
+                        dayIndices(iday) = icol;
+                    }
+                }
+            });
+
+            auto block_offsets_h = block_offsets.createHostCopy();
+            return block_offsets_h(nblocks+1);
+        }
+
         /*
          * The following routines provide a simple interface to RRTMGP. These
          * can be used as-is, but are intended to be wrapped by the SCREAM AD
@@ -80,6 +275,7 @@ namespace scream {
 
         void rrtmgp_finalize() {
             initialized = false;
+            workspace = RadiationWorkspace();
             k_dist_sw.finalize();
             k_dist_lw.finalize();
             cloud_optics_sw.finalize(); //~CloudOptics();
@@ -132,17 +328,16 @@ namespace scream {
                 CloudOptics &cloud_optics, GasOpticsRRTMGP &kdist,
                 real2d &p_lay, real2d &t_lay, real2d &lwp, real2d &iwp, real2d &rel, real2d &rei) {
  
-            // Initialize optics
-            OpticalProps2str clouds;
-            clouds.init(kdist.get_band_lims_wavenumber());
-            clouds.alloc_2str(ncol, nlay);
+            // Optics are persistent, and allocated when the workspace is set up
+            auto& ws = get_workspace(ncol, nlay, p_lay);
+            OpticalProps2str clouds = ws.clouds_sw;
 
             // Needed for consistency with all-sky example problem?
             cloud_optics.set_ice_roughness(2);
- 
+
             // Limit effective radii to be within bounds of lookup table
-            auto rel_limited = real2d("rel_limited", ncol, nlay);
-            auto rei_limited = real2d("rei_limited", ncol, nlay);
+            auto &rel_limited = ws.rel_limited;
+            auto &rei_limited = ws.rei_limited;
             limit_to_bounds(rel, cloud_optics.radliq_lwr, cloud_optics.radliq_upr, rel_limited);
             limit_to_bounds(rei, cloud_optics.radice_lwr, cloud_optics.radice_upr, rei_limited);
 
@@ -159,17 +354,16 @@ namespace scream {
                 CloudOptics &cloud_optics, GasOpticsRRTMGP &kdist, 
                 real2d &p_lay, real2d &t_lay, real2d &lwp, real2d &iwp, real2d &rel, real2d &rei) {
 
-            // Initialize optics
-            OpticalProps1scl clouds;
-            clouds.init(kdist.get_band_lims_wavenumber());
-            clouds.alloc_1scl(ncol, nlay);  // this is dumb, why do we need to init and alloc separately?!
+            // Optics are persistent, and allocated when the workspace is set up
+            auto& ws = get_workspace(ncol, nlay, p_lay);
+            OpticalProps1scl clouds = ws.clouds_lw;
 
             // Needed for consistency with all-sky example problem?
             cloud_optics.set_ice_roughness(2);
 
             // Limit effective radii to be within bounds of lookup table
-            auto rel_limited = real2d("rel_limited", ncol, nlay);
-            auto rei_limited = real2d("rei_limited", ncol, nlay);
+            auto &rel_limited = ws.rel_limited;
+            auto &rei_limited = ws.rei_limited;
             limit_to_bounds(rel, cloud_optics.radliq_lwr, cloud_optics.radliq_upr, rel_limited);
             limit_to_bounds(rei, cloud_optics.radice_lwr, cloud_optics.radice_upr, rei_limited);
 
@@ -194,54 +388,52 @@ namespace scream {
             int ngpt = k_dist.get_ngpt();
             int ngas = gas_concs.get_num_gases();
 
+            auto& ws = get_workspace(ncol, nlay, p_lay);
+            const bool top_at_1 = ws.top_at_1;
+
             // Get daytime indices
-            auto dayIndices = int1d("dayIndices", ncol);
-            memset(dayIndices, -1);
-            // Loop below has to be done on host, so create host copies
-            // TODO: there is probably a way to do this on the device
-            auto dayIndices_h = dayIndices.createHostCopy();
-            auto mu0_h = mu0.createHostCopy();
-            int nday = 0;
-            for (int icol = 1; icol <= ncol; icol++) {
-                if (mu0_h(icol) > 0) {
-                    nday++;
-                    dayIndices_h(nday) = icol;
-                }
-            }
-            // Copy data back to the device
-            dayIndices_h.deep_copy_to(dayIndices);
+            auto &dayIndices = ws.day_indices;
+            const int nday = compact_daytime_columns(ncol, mu0, dayIndices, ws.block_offsets);
             if (nday == 0) { 
                 std::cout << "WARNING: no daytime columns found for this chunk!\n";
                 return;
             }
 
+            // Daytime RRTMGP objects alias the workspace ones, allocated for ncol columns
+            auto gas_names = gas_concs.get_gas_names();
+            if (not ws.gas_concs_day_alloc) {
+                ws.gas_concs_day = GasConcs();
+                ws.gas_concs_day.init(gas_names, ncol, nlay);
+                ws.gas_concs_day_alloc = true;
+            }
+            auto gas_concs_day = alias_day_columns(ws.gas_concs_day, nday);
+            auto clouds_day    = alias_day_columns(ws.clouds_day, nday);
+            auto optics        = alias_day_columns(ws.optics_sw, nday);
+
             // Subset mu0
-            auto mu0_day = real1d("mu0_day", nday);
+            real1d mu0_day("mu0_day", ws.mu0_day.data(), nday);
             parallel_for(Bounds<1>(nday), YAKL_LAMBDA(int iday) {
                 mu0_day(iday) = mu0(dayIndices(iday));
             });
 
             // subset state variables
-            auto p_lay_day = real2d("p_lay_day", nday, nlay);
-            auto t_lay_day = real2d("t_lay_day", nday, nlay);
+            real2d p_lay_day("p_lay_day", ws.p_lay_day.data(), nday, nlay);
+            real2d t_lay_day("t_lay_day", ws.t_lay_day.data(), nday, nlay);
             parallel_for(Bounds<2>(nlay,nday), YAKL_LAMBDA(int ilay, int iday) {
                 p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
                 t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
             });
-            auto p_lev_day = real2d("p_lev_day", nday, nlay+1);
-            auto t_lev_day = real2d("t_lev_day", nday, nlay+1);
+            real2d p_lev_day("p_lev_day", ws.p_lev_day.data(), nday, nlay+1);
+            real2d t_lev_day("t_lev_day", ws.t_lev_day.data(), nday, nlay+1);
             parallel_for(Bounds<2>(nlay+1,nday), YAKL_LAMBDA(int ilev, int iday) {
                 p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
                 t_lev_day(iday,ilev) = t_lev(dayIndices(iday),ilev);
             });
 
-            // Subset gases
-            auto gas_names = gas_concs.get_gas_names();
-            GasConcs gas_concs_day;
-            gas_concs_day.init(gas_names, nday, nlay);
+            // Subset gases (set_vmr copies the data, so the buffers can be reused)
+            auto &vmr = ws.vmr;
+            real2d vmr_day("vmr_day", ws.vmr_day.data(), nday, nlay);
             for (int igas = 1; igas <= ngas; igas++) {
-                auto vmr_day = real2d("vmr_day", nday, nlay);
-                auto vmr     = real2d("vmr"    , ncol, nlay);
                 gas_concs.get_vmr(gas_names(igas), vmr);
                 parallel_for(Bounds<2>(nlay,nday), YAKL_LAMBDA(int ilay, int iday) {
                     vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
@@ -250,9 +442,6 @@ namespace scream {
             }
 
             // Subset cloud optics
-            OpticalProps2str clouds_day;
-            clouds_day.init(k_dist.get_band_lims_wavenumber());
-            clouds_day.alloc_2str(nday, nlay);
             parallel_for(Bounds<3>(nbnd,nlay,nday), YAKL_LAMBDA(int ibnd, int ilay, int iday) {
                 clouds_day.tau(iday,ilay,ibnd) = clouds.tau(dayIndices(iday),ilay,ibnd);
                 clouds_day.ssa(iday,ilay,ibnd) = clouds.ssa(dayIndices(iday),ilay,ibnd);
@@ -262,22 +451,15 @@ namespace scream {
             // RRTMGP assumes surface albedos have a screwy dimension ordering
             // for some strange reason, so we need to transpose these; also do
             // daytime subsetting in the same kernel
-            real2d sfc_alb_dir_T("sfc_alb_dir", nbnd, nday);
-            real2d sfc_alb_dif_T("sfc_alb_dif", nbnd, nday);
+            real2d sfc_alb_dir_T("sfc_alb_dir", ws.sfc_alb_dir_T.data(), nbnd, nday);
+            real2d sfc_alb_dif_T("sfc_alb_dif", ws.sfc_alb_dif_T.data(), nbnd, nday);
             parallel_for(Bounds<2>(nbnd,nday), YAKL_LAMBDA(int ibnd, int icol) {
                 sfc_alb_dir_T(ibnd,icol) = sfc_alb_dir(dayIndices(icol),ibnd);
                 sfc_alb_dif_T(ibnd,icol) = sfc_alb_dif(dayIndices(icol),ibnd);
             });
 
-            // Allocate space for optical properties
-            OpticalProps2str optics;
-            optics.alloc_2str(nday, nlay, k_dist);
-
             // Do gas optics
-            real2d toa_flux("toa_flux", nday, ngpt);
-            auto p_lay_host = p_lay.createHostCopy();
-            bool top_at_1 = p_lay_host(1, 1) < p_lay_host(1, nlay);
-
+            real2d toa_flux("toa_flux", ws.toa_flux.data(), nday, ngpt);
             k_dist.gas_optics(nday, nlay, top_at_1, p_lay_day, p_lev_day, t_lay_day, gas_concs_day, optics, toa_flux);
 
             // Combine gas and cloud optics
@@ -285,13 +467,13 @@ namespace scream {
             clouds_day.increment(optics);
 
             // Compute fluxes on daytime columns
-            auto flux_up_day = real2d("flux_up_day", nday, nlay+1);
-            auto flux_dn_day = real2d("flux_dn_day", nday, nlay+1);
-            auto flux_dn_dir_day = real2d("flux_dn_dir_day", nday, nlay+1);
+            real2d flux_up_day    ("flux_up_day"    , ws.flux_up_day.data()    , nday, nlay+1);
+            real2d flux_dn_day    ("flux_dn_day"    , ws.flux_dn_day.data()    , nday, nlay+1);
+            real2d flux_dn_dir_day("flux_dn_dir_day", ws.flux_dn_dir_day.data(), nday, nlay+1);
             FluxesBroadband fluxes_day;
-            fluxes_day.flux_up     = flux_up_day; //real2d("flux_up"    , nday,nlay+1);
-            fluxes_day.flux_dn     = flux_dn_day; //real2d("flux_dn"    , nday,nlay+1);
-            fluxes_day.flux_dn_dir = flux_dn_dir_day; //real2d("flux_dn_dir", nday,nlay+1);
+            fluxes_day.flux_up     = flux_up_day;
+            fluxes_day.flux_dn     = flux_dn_day;
+            fluxes_day.flux_dn_dir = flux_dn_dir_day;
             rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
 
             // Zero out all fluxes before expanding daytime fluxes
@@ -321,25 +503,24 @@ namespace scream {
                 OpticalProps1scl &clouds,
                 FluxesBroadband &fluxes) {
 
-            // Problem size
-            int nbnd = k_dist.get_nband();
+            auto& ws = get_workspace(ncol, nlay, p_lay);
+            const bool top_at_1 = ws.top_at_1;
 
-            // Allocate space for optical properties
-            OpticalProps1scl optics;
-            optics.alloc_1scl(ncol, nlay, k_dist);
+            // Optical properties and sources are persistent
+            auto &optics = ws.optics_lw;
+            auto &lw_sources = ws.lw_sources;
 
             // Boundary conditions
-            SourceFuncLW lw_sources;
-            lw_sources.alloc(ncol, nlay, k_dist);
-            real1d t_sfc   ("t_sfc"        ,ncol);
-            real2d emis_sfc("emis_sfc",nbnd,ncol);
-
-            // Surface temperature
-            auto p_lay_host = p_lay.createHostCopy();
-            bool top_at_1 = p_lay_host(1, 1) < p_lay_host(1, nlay);
-            auto t_lev_host = t_lev.createHostCopy();
-            memset( t_sfc    , t_lev_host(1, merge(nlay+1, 1, top_at_1)) );
-            memset( emis_sfc , 0.98_wp                                   );
+            auto &t_sfc = ws.t_sfc;
+            auto &emis_sfc = ws.emis_sfc;
+
+            // Surface temperature (taken from the first column, as before, but
+            // without copying t_lev to host)
+            const int ilev_sfc = merge(nlay+1, 1, top_at_1);
+            parallel_for(Bounds<1>(ncol), YAKL_LAMBDA(int icol) {
+                t_sfc(icol) = t_lev(1, ilev_sfc);
+            });
+            memset( emis_sfc , 0.98_wp );
 
             // Do gas optics
             k_dist.gas_optics(ncol, nlay, top_at_1, p_lay, p_lev, t_lay, t_sfc, gas_concs, optics, lw_sources, real2d(), t_lev);
@@ -347,31 +528,9 @@ namespace scream {
             // Combine gas and cloud optics
             clouds.increment(optics);
 
-            // Get Gaussian quadrature weights
-            // TODO: move this crap out of userland!
-            // Weights and angle secants for first order (k=1) Gaussian quadrature.
-            //   Values from Table 2, Clough et al, 1992, doi:10.1029/92JD01419
-            //   after Abramowitz & Stegun 1972, page 921
-            int constexpr max_gauss_pts = 4;
-            realHost2d gauss_Ds_host ("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
-            gauss_Ds_host(1,1) = 1.66_wp      ; gauss_Ds_host(2,1) =         0._wp; gauss_Ds_host(3,1) =         0._wp; gauss_Ds_host(4,1) =         0._wp;
-            gauss_Ds_host(1,2) = 1.18350343_wp; gauss_Ds_host(2,2) = 2.81649655_wp; gauss_Ds_host(3,2) =         0._wp; gauss_Ds_host(4,2) =         0._wp;
-            gauss_Ds_host(1,3) = 1.09719858_wp; gauss_Ds_host(2,3) = 1.69338507_wp; gauss_Ds_host(3,3) = 4.70941630_wp; gauss_Ds_host(4,3) =         0._wp;
-            gauss_Ds_host(1,4) = 1.06056257_wp; gauss_Ds_host(2,4) = 1.38282560_wp; gauss_Ds_host(3,4) = 2.40148179_wp; gauss_Ds_host(4,4) = 7.15513024_wp;
-
-            realHost2d gauss_wts_host("gauss_wts",max_gauss_pts,max_gauss_pts);
-            gauss_wts_host(1,1) = 0.5_wp         ; gauss_wts_host(2,1) = 0._wp          ; gauss_wts_host(3,1) = 0._wp          ; gauss_wts_host(4,1) = 0._wp          ;
-            gauss_wts_host(1,2) = 0.3180413817_wp; gauss_wts_host(2,2) = 0.1819586183_wp; gauss_wts_host(3,2) = 0._wp          ; gauss_wts_host(4,2) = 0._wp          ;
-            gauss_wts_host(1,3) = 0.2009319137_wp; gauss_wts_host(2,3) = 0.2292411064_wp; gauss_wts_host(3,3) = 0.0698269799_wp; gauss_wts_host(4,3) = 0._wp          ;
-            gauss_wts_host(1,4) = 0.1355069134_wp; gauss_wts_host(2,4) = 0.2034645680_wp; gauss_wts_host(3,4) = 0.1298475476_wp; gauss_wts_host(4,4) = 0.0311809710_wp;
-
-            real2d gauss_Ds ("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
-            real2d gauss_wts("gauss_wts",max_gauss_pts,max_gauss_pts);
-            gauss_Ds_host .deep_copy_to(gauss_Ds );
-            gauss_wts_host.deep_copy_to(gauss_wts);
-
             // Compute fluxes
-            rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, optics, top_at_1, lw_sources, emis_sfc, fluxes);
+            int constexpr max_gauss_pts = 4;
+            rte_lw(max_gauss_pts, ws.gauss_Ds, ws.gauss_wts, optics, top_at_1, lw_sources, emis_sfc, fluxes);
 
         }
 
@@ -71,6 +71,20 @@ struct Functions
 
   using Workspace = typename ekat::WorkspaceManager<Spack, Device>::Workspace;
 
+  // Table of Murphy-Koop saturation vapor pressures, for the table-lookup mode
+  // of qv_sat. Values and derivatives (scaled by the spacing) are stored at
+  // uniformly spaced temperatures, and evaluated by cubic Hermite
+  // interpolation, so lookups need no transcendental functions. Build it once
+  // with make_saturation_table, and pass it to the call sites that use it.
+  struct SaturationTable {
+    // Temperature of the first entry [K], and inverse of the spacing [1/K]
+    Scalar t_min;
+    Scalar inv_dt;
+
+    view_1d<const Scalar> liq, dliq;
+    view_1d<const Scalar> ice, dice;
+  };
+
   //
   // --------- Functions ---------
   //
@@ -92,12 +106,34 @@ struct Functions
   KOKKOS_FUNCTION
   static Spack MurphyKoop_svp(const Spack& t, const bool ice, const Smask& range_mask);
 
+  //  The ice (eq. 7) and liquid (eq. 10) formulas of Murphy and Koop (2005),
+  //  without any check on temperature or phase
+  KOKKOS_FUNCTION
+  static Spack MurphyKoop_svp_ice(const Spack& t);
+  KOKKOS_FUNCTION
+  static Spack MurphyKoop_svp_liq(const Spack& t);
+
+  //  Build the table used by the table-lookup versions of svp and qv_sat
+  static SaturationTable make_saturation_table();
+
+  //  compute saturation vapor pressure by interpolating the Murphy and Koop
+  //  (2005) formulation from a table. Temperatures outside of the table range
+  //  fall back to MurphyKoop_svp.
+  //  returned in units of pa; t is input in units of k.
+  //  ice refers to saturation with respect to liquid (false) or ice (true)
+  KOKKOS_FUNCTION
+  static Spack MurphyKoop_svp(const SaturationTable& table, const Spack& t, const bool ice, const Smask& range_mask);
+
   // Calls a function to obtain the saturation vapor pressure, and then computes
   // and returns the saturation mixing ratio, with respect to either liquid or ice,
   // depending on value of 'ice'
   KOKKOS_FUNCTION
   static Spack qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, const Smask& range_mask, const SaturationFcn func_idx = MurphyKoop);
 
+  // Same as above, but the saturation vapor pressure is looked up in a table
+  KOKKOS_FUNCTION
+  static Spack qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, const Smask& range_mask, const SaturationTable& table);
+
   //checks temperature for negatives and NaNs
   KOKKOS_FUNCTION
   static void check_temperature(const Spack& t_atm, const char* func_name, const Smask& range_mask);
@@ -0,0 +1,82 @@
+#include "physics_ic_regimes.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace scream {
+namespace physics {
+
+std::string e2str (const Regime r) {
+  switch (r) {
+    case Regime::ClearSky:       return "clear_sky";
+    case Regime::Stratocumulus:  return "stratocumulus";
+    case Regime::DeepConvection: return "deep_convection";
+    case Regime::PolarIce:       return "polar_ice";
+    default:
+      EKAT_ERROR_MSG("Error! Unrecognized regime.\n");
+  }
+  return "INVALID";
+}
+
+std::vector<ColumnRegime>
+sample_column_regimes (const Int ncol, const RegimeWeights& weights, const unsigned seed)
+{
+  Real total = 0;
+  for (const auto w : weights) {
+    EKAT_REQUIRE_MSG (w>=0, "Error! Regime weights must be non-negative.\n");
+    total += w;
+  }
+  EKAT_REQUIRE_MSG (total>0, "Error! At least one regime weight must be positive.\n");
+
+  // Note: we don't use std's distributions, since their implementation
+  // is library-dependent, while the mt19937 sequence is not.
+  std::mt19937 engine(seed);
+  auto uniform = [&] () -> Real {
+    return (engine() >> 8) * (1.0/16777216.0);
+  };
+
+  // The regimes that can appear at all
+  std::vector<Regime> active;
+  for (int r=0; r<num_regimes; ++r) {
+    if (weights[r]>0) {
+      active.push_back(static_cast<Regime>(r));
+    }
+  }
+
+  std::vector<ColumnRegime> regimes(ncol);
+  for (Int i=0; i<ncol; ++i) {
+    auto& c = regimes[i];
+    if (i<static_cast<Int>(active.size())) {
+      c.regime = active[i];
+    } else {
+      const Real u = uniform()*total;
+      Real cumulative = 0;
+      int r = 0;
+      for (; r<num_regimes-1; ++r) {
+        // Note: zero-weight regimes are never selected, since u<cumulative
+        //       would have been true already at the previous regime.
+        cumulative += weights[r];
+        if (u<cumulative) {
+          break;
+        }
+      }
+      c.regime = static_cast<Regime>(r);
+    }
+    c.strength = uniform();
+  }
+
+  return regimes;
+}
+
+Real ic_saturation_mixing_ratio (const Real T, const Real p)
+{
+  const Real es = 611.2*std::exp(17.67*(T-273.15)/(T-29.65));
+  // Don't let es go above p (it can happen near the model top)
+  return 0.622*es/std::max(p-es,Real(0.1)*p);
+}
+
+} // namespace physics
+} // namespace scream
@@ -0,0 +1,65 @@
+#ifndef SCREAM_PHYSICS_IC_REGIMES_HPP
+#define SCREAM_PHYSICS_IC_REGIMES_HPP
+
+#include "share/scream_types.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace scream {
+namespace physics {
+
+/*
+ * Utilities to build initial conditions made of columns in different
+ * meteorological regimes.
+ *
+ * Physics parametrizations branch heavily on the column state (e.g., P3 skips
+ * columns/levels with no condensate, and the number of sedimentation substeps
+ * depends on the fall speeds). An IC made of copies of a single column hides
+ * these effects, so performance tests should use a mix of regimes instead.
+ * Each parametrization's IC factory decides how a column in a given regime
+ * looks like; here we only decide which regime each column is in.
+ */
+
+enum class Regime {
+  ClearSky,        // No condensate, subsaturated
+  Stratocumulus,   // Shallow marine liquid cloud, with some drizzle
+  DeepConvection,  // Deep mixed-phase cloud, with heavy rain
+  PolarIce,        // Cold, with ice throughout the lower troposphere
+};
+
+constexpr int num_regimes = 4;
+
+std::string e2str (const Regime r);
+
+// Relative frequency of each regime, indexed by the int value of the regime.
+using RegimeWeights = std::array<Real,num_regimes>;
+
+// Roughly the global frequency of each regime.
+inline RegimeWeights default_regime_weights () { return {0.4, 0.25, 0.15, 0.2}; }
+
+struct ColumnRegime {
+  Regime regime;
+  // A number in [0,1), used to add variability between columns in the same
+  // regime (e.g., cloud depth, condensate amounts).
+  Real   strength;
+};
+
+// Assign a regime to each column. The first columns go through all regimes
+// with a positive weight (so that even small ICs contain all of them), while
+// the others are sampled according to the given weights. The sampling only
+// depends on the seed, so that baseline and comparison runs see the same columns.
+std::vector<ColumnRegime>
+sample_column_regimes (const Int ncol,
+                       const RegimeWeights& weights = default_regime_weights(),
+                       const unsigned seed = 0);
+
+// A cheap approximation (Tetens formula) of the saturation mixing ratio
+// over liquid, good enough to build ICs.
+Real ic_saturation_mixing_ratio (const Real T, const Real p);
+
+} // namespace physics
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_IC_REGIMES_HPP
@@ -42,7 +42,11 @@ build_grids (const std::set<std::string>& grid_names,
   const int num_global_cols = phys_only_gm_params.get<int>("Number of global columns");
   const int num_vertical_lev = phys_only_gm_params.get<int>("Number of vertical levels");
 
-  auto grid = create_point_grid("Physics",num_global_cols,num_vertical_lev,m_comm);
+  // For ensemble runs, the columns of all members are stacked in one grid,
+  // and the number of global columns is the one of each member.
+  const int num_members = phys_only_gm_params.get<int>("Number of ensemble members",1);
+
+  auto grid = create_point_grid("Physics",num_global_cols,num_vertical_lev,num_members,m_comm);
 
   m_grids["Physics"] = grid;
 }
@@ -55,27 +55,134 @@ Functions<S,D>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask&
   const Smask liq_mask = !ice_mask;
 
   if (ice_mask.any()) {
-    //Equation (7) of the paper
-    // (good down to 110 K)
-    //creating array for storing coefficients of ice sat equation
-    static constexpr Scalar ic[]= {9.550426, 5723.265, 3.53068, 0.00728332};
-    const Spack ice_result = exp(ic[0] - (ic[1] / t_atm) + (ic[2] * log(t_atm)) - (ic[3] * t_atm));
+    result.set(ice_mask, MurphyKoop_svp_ice(t_atm));
+  }
 
-    result.set(ice_mask, ice_result);
+  if (liq_mask.any()) {
+    result.set(liq_mask, MurphyKoop_svp_liq(t_atm));
   }
 
+  return result;
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::MurphyKoop_svp_ice(const Spack& t_atm)
+{
+  //Equation (7) of the paper
+  // (good down to 110 K)
+  //creating array for storing coefficients of ice sat equation
+  static constexpr Scalar ic[]= {9.550426, 5723.265, 3.53068, 0.00728332};
+  return exp(ic[0] - (ic[1] / t_atm) + (ic[2] * log(t_atm)) - (ic[3] * t_atm));
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::MurphyKoop_svp_liq(const Spack& t_atm)
+{
+  //Equation (10) of the paper
+  // (good for 123 < T < 332 K)
+  //creating array for storing coefficients of liq sat equation
+  static constexpr Scalar lq[] = {54.842763, 6763.22, 4.210, 0.000367, 0.0415, 218.8, 53.878,
+		       1331.22, 9.44523, 0.014025 };
+  const auto logt = log(t_atm);
+  return exp(lq[0] - (lq[1] / t_atm) - (lq[2] * logt) + (lq[3] * t_atm) +
+	     (tanh(lq[4] * (t_atm - lq[5])) * (lq[6] - (lq[7] / t_atm) -
+					       (lq[8] * logt) + lq[9] * t_atm)));
+}
+
+template <typename S, typename D>
+typename Functions<S,D>::SaturationTable
+Functions<S,D>::make_saturation_table()
+{
+  // Range and spacing of the table [K]. The relative interpolation error is
+  // about (dt*dlnE/dT)^4/384, i.e. below 1e-7 over the whole range.
+  constexpr Scalar t_min = 150;
+  constexpr Scalar t_max = 350;
+  constexpr Scalar dt    = 0.25;
+  const Int n = static_cast<Int>((t_max - t_min)/dt + sp(0.5)) + 1;
+
+  view_1d<Scalar> liq("svp_liq",n), dliq("svp_dliq",n), ice("svp_ice",n), dice("svp_dice",n);
+  auto liq_h  = Kokkos::create_mirror_view(liq);
+  auto dliq_h = Kokkos::create_mirror_view(dliq);
+  auto ice_h  = Kokkos::create_mirror_view(ice);
+  auto dice_h = Kokkos::create_mirror_view(dice);
+
+  // Derivatives are computed with 4th order centered differences, and scaled
+  // by dt, which is what the Hermite interpolant needs.
+  const Scalar h = dt/10;
+  const auto liq_f = [] (const Scalar t) { return MurphyKoop_svp_liq(Spack(t))[0]; };
+  const auto ice_f = [] (const Scalar t) { return MurphyKoop_svp_ice(Spack(t))[0]; };
+  const auto deriv = [&] (const auto& f, const Scalar t) {
+    return (-f(t+2*h) + 8*f(t+h) - 8*f(t-h) + f(t-2*h)) / (12*h) * dt;
+  };
+  for (Int k = 0; k < n; ++k) {
+    const Scalar t = t_min + k*dt;
+    liq_h(k)  = liq_f(t);
+    dliq_h(k) = deriv(liq_f, t);
+    ice_h(k)  = ice_f(t);
+    dice_h(k) = deriv(ice_f, t);
+  }
+  Kokkos::deep_copy(liq,  liq_h);
+  Kokkos::deep_copy(dliq, dliq_h);
+  Kokkos::deep_copy(ice,  ice_h);
+  Kokkos::deep_copy(dice, dice_h);
+
+  SaturationTable table;
+  table.t_min  = t_min;
+  table.inv_dt = 1/dt;
+  table.liq  = liq;
+  table.dliq = dliq;
+  table.ice  = ice;
+  table.dice = dice;
+  return table;
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::MurphyKoop_svp(const SaturationTable& table, const Spack& t_atm, const bool ice, const Smask& range_mask)
+{
+  //First check if the temperature is legitimate or not
+  check_temperature(t_atm, "MurphyKoop_svp", range_mask);
+
+  static constexpr  auto tmelt = C::Tmelt;
+  const Smask ice_mask = (t_atm < tmelt) && ice;
+  const Smask liq_mask = !ice_mask;
+
+  // Locate t_atm in the table. Padded entries are sent to the first interval,
+  // and out of range ones are clamped (and recomputed below).
+  const Scalar xmax = table.liq.extent_int(0) - 1;
+  const Spack x = (t_atm - table.t_min) * table.inv_dt;
+  const Smask in_range = (x >= 0) && (x <= xmax);
+  Spack xc = min(max(x, sp(0)), xmax);
+  xc.set(!range_mask, 0);
+  IntSmallPack i(xc);
+  i.set(xc >= xmax, static_cast<Int>(xmax) - 1);
+  const Spack s  = xc - Spack(i);
+  const Spack s1 = 1 - s;
+
+  // Cubic Hermite basis functions
+  const Spack h00 = (1 + 2*s)*s1*s1;
+  const Spack h10 = s*s1*s1;
+  const Spack h01 = s*s*(3 - 2*s);
+  const Spack h11 = -s*s*s1;
+
+  Spack result;
+  if (ice_mask.any()) {
+    result.set(ice_mask, h00*ekat::index(table.ice, i)   + h10*ekat::index(table.dice, i) +
+                         h01*ekat::index(table.ice, i+1) + h11*ekat::index(table.dice, i+1));
+  }
   if (liq_mask.any()) {
-    //Equation (10) of the paper
-    // (good for 123 < T < 332 K)
-    //creating array for storing coefficients of liq sat equation
-    static constexpr Scalar lq[] = {54.842763, 6763.22, 4.210, 0.000367, 0.0415, 218.8, 53.878,
-			 1331.22, 9.44523, 0.014025 };
-    const auto logt = log(t_atm);
-    const Spack liq_result = exp(lq[0] - (lq[1] / t_atm) - (lq[2] * logt) + (lq[3] * t_atm) +
-			   (tanh(lq[4] * (t_atm - lq[5])) * (lq[6] - (lq[7] / t_atm) -
-							 (lq[8] * logt) + lq[9] * t_atm)));
+    result.set(liq_mask, h00*ekat::index(table.liq, i)   + h10*ekat::index(table.dliq, i) +
+                         h01*ekat::index(table.liq, i+1) + h11*ekat::index(table.dliq, i+1));
+  }
 
-    result.set(liq_mask, liq_result);
+  const Smask out_of_range = range_mask && !in_range;
+  if (out_of_range.any()) {
+    result.set(out_of_range, MurphyKoop_svp(t_atm, ice, out_of_range));
   }
 
   return result;
@@ -156,6 +263,17 @@ Functions<S,D>::qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, c
   return ep_2 * e_pres / max(p_atm-e_pres, sp(1.e-3));
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, const Smask& range_mask, const SaturationTable& table)
+{
+  const Spack e_pres = MurphyKoop_svp(table, t_atm, ice, range_mask); // saturation vapor pressure [Pa]
+
+  static constexpr  auto ep_2 = C::ep_2;
+  return ep_2 * e_pres / max(p_atm-e_pres, sp(1.e-3));
+}
+
 } // namespace physics
 } // namespace scream
 
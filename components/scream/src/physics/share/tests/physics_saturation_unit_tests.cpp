@@ -403,6 +403,52 @@ struct UnitWrap::UnitTest<D>::TestSaturation
     Kokkos::fence();
     REQUIRE(nerr == 0);
   }
+
+  static void run_table()
+  {
+    // Check the table-lookup versions of MurphyKoop_svp and qv_sat against the
+    // direct evaluation, for temperatures covering the whole table as well as
+    // values outside of it (which fall back on the direct evaluation).
+    using physics = scream::physics::Functions<Scalar, Device>;
+
+    const auto table = physics::make_saturation_table();
+
+    static constexpr Scalar t_lo = 140;
+    static constexpr Scalar t_hi = 360;
+    static constexpr Scalar pres = 85000;
+    const Scalar tol = std::max(Scalar(1e-6), 100*C::macheps);
+
+    const int npacks = 1000;
+    int nerr = 0;
+    Kokkos::parallel_reduce("TestSaturation::run_table", RangePolicy(0, npacks),
+                            KOKKOS_LAMBDA(const int& i, int& errors) {
+      Spack temps;
+      for (int s = 0; s < Spack::n; ++s) {
+        temps[s] = t_lo + (t_hi - t_lo)*(i*Spack::n + s)/(npacks*Spack::n - 1);
+      }
+      const Spack p(pres);
+      const Smask range_mask(true);
+
+      for (int iice = 0; iice < 2; ++iice) {
+        const bool ice = iice == 1;
+        const Spack svp_exact = physics::MurphyKoop_svp(temps, ice, range_mask);
+        const Spack svp_table = physics::MurphyKoop_svp(table, temps, ice, range_mask);
+        const Spack qv_exact  = physics::qv_sat(temps, p, ice, range_mask, physics::MurphyKoop);
+        const Spack qv_table  = physics::qv_sat(temps, p, ice, range_mask, table);
+        for (int s = 0; s < Spack::n; ++s) {
+          if (std::abs(svp_table[s] - svp_exact[s]) > tol*svp_exact[s] ||
+              std::abs(qv_table[s] - qv_exact[s]) > tol*qv_exact[s]) {
+            printf("svp table: t=%e ice=%d svp=%e %e qv=%e %e\n", temps[s], ice,
+                   svp_table[s], svp_exact[s], qv_table[s], qv_exact[s]);
+            ++errors;
+          }
+        }
+      }
+    }, nerr);
+
+    Kokkos::fence();
+    REQUIRE(nerr == 0);
+  }
 }; //end of TestSaturation struct
 
 } // namespace unit_test
@@ -416,4 +462,9 @@ TEST_CASE("physics_saturation_test", "[physics_saturation_test]"){
 
  } // TEST_CASE
 
+TEST_CASE("physics_saturation_table_test", "[physics_saturation_test]"){
+  scream::physics::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestSaturation::run_table();
+
+ } // TEST_CASE
+
 } // namespace
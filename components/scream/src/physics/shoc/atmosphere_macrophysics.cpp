@@ -12,6 +12,27 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
 /* Anything that can be initialized without grid information can be initialized here.
  * Like universal constants, shoc options.
 */
+
+  // Number of SHOC substeps per atm step (defaults to 1, i.e., no sub-stepping)
+  m_nadv = 1;
+  if (m_shoc_params.isParameter("Number of Subcycles")) {
+    m_nadv = m_shoc_params.get<int>("Number of Subcycles");
+  }
+  EKAT_REQUIRE_MSG(m_nadv>=1, "Error! SHOC 'Number of Subcycles' must be positive.\n");
+
+  // Team and vector sizes for shoc_main (a team size of 0 means the default policy is used)
+  m_team_size   = m_shoc_params.isParameter("Team Size")   ? m_shoc_params.get<int>("Team Size")   : 0;
+  m_vector_size = m_shoc_params.isParameter("Vector Size") ? m_shoc_params.get<int>("Vector Size") : 1;
+  EKAT_REQUIRE_MSG(m_team_size>=0, "Error! SHOC 'Team Size' must be non-negative.\n");
+  EKAT_REQUIRE_MSG(m_vector_size>=1, "Error! SHOC 'Vector Size' must be positive.\n");
+
+  // Runtime selection of the team size (see util::TeamSizeTuner)
+  m_autotune = m_shoc_params.isParameter("Autotune Team Size") && m_shoc_params.get<bool>("Autotune Team Size");
+  m_tuning_cache_file = m_shoc_params.isParameter("Tuning Cache File") ? m_shoc_params.get<std::string>("Tuning Cache File")
+                                                                  : "scream_tuning_cache.txt";
+  m_tuning_cache_only = m_shoc_params.isParameter("Tuning Cache Only") && m_shoc_params.get<bool>("Tuning Cache Only");
+  EKAT_REQUIRE_MSG(not (m_autotune && m_team_size>0),
+      "Error! SHOC 'Team Size' and 'Autotune Team Size' cannot be used together.\n");
 }
 
 // =========================================================================================
@@ -93,6 +114,22 @@ void SHOCMacrophysics::set_grids(const std::shared_ptr<const GridsManager> grids
 
   // Tracer group
   add_group<Updated>("tracers",grid->name(),ps,Bundling::Required);
+
+  // Team policy for shoc_main. It is needed to size the workspace manager buffer,
+  // so build it as soon as the number of columns is known.
+  const int npacks = ekat::npack<Spack>(m_num_levs);
+  if (m_autotune) {
+    // All ranks must agree on whether tuning happens (timings are reduced
+    // across ranks), so the key uses the max number of columns over all ranks.
+    int max_cols = m_num_cols;
+    MPI_Allreduce(MPI_IN_PLACE, &max_cols, 1, MPI_INT, MPI_MAX, m_shoc_comm.mpi_comm());
+    const auto key = util::TeamSizeTuner::make_key<KT::ExeSpace>("shoc_main",max_cols,m_num_levs);
+    m_tuner = util::TeamSizeTuner(key, util::team_size_candidates<KT::ExeSpace>(npacks),
+                                  m_tuning_cache_file, m_shoc_comm, m_tuning_cache_only);
+  } else {
+    m_tuner = util::TeamSizeTuner(m_team_size);
+  }
+  m_policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, npacks, m_tuner.team_size(), m_vector_size);
 }
 
 // =========================================================================================
@@ -132,10 +169,14 @@ int SHOCMacrophysics::requested_buffer_size_in_bytes() const
                                 Buffer::num_2d_vector_tr*m_num_cols*num_tracer_packs*sizeof(Spack);
 
   // Number of Reals needed by the WorkspaceManager passed to shoc_main
-  const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
   const int n_wind_slots  = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots  = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const int wsm_request   = WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy);
+  // While the team size is being tuned, the policy changes, so use the max over all candidates.
+  int wsm_request = 0;
+  for (const int ts : m_tuner.candidates()) {
+    const auto policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, nlev_packs, ts, m_vector_size);
+    wsm_request = std::max(wsm_request, WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy));
+  }
 
   return interface_request + wsm_request;
 }
@@ -232,10 +273,13 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
 
   // Compute workspace manager size to check used memory
   // vs. requested memory
-  const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy)/sizeof(Spack);
+  int wsm_size = 0;
+  for (const int ts : m_tuner.candidates()) {
+    const auto policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, nlev_packs, ts, m_vector_size);
+    wsm_size = std::max(wsm_size, WSM::get_total_bytes_needed(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy)/int(sizeof(Spack)));
+  }
   s_mem += wsm_size;
 
   int used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -350,6 +394,21 @@ void SHOCMacrophysics::initialize_impl (const util::TimeStamp& t0)
   shoc_postprocess.set_variables(m_num_cols,m_num_levs,
                                  rrho,qv,qv_copy,qc,qc_copy,tke,tke_copy,shoc_ql2,
                                  cldfrac_liq,sgs_buoy_flux,inv_qc_relvar);
+
+  // Calculate maximum number of levels in pbl from surface. This only depends
+  // on the reference pressure profile, which is fixed, so it is computed once
+  // here rather than at every step (shoc_init reduces on device and copies
+  // the result back to host).
+  const auto pref_mid = m_shoc_fields_in["pref_mid"].get_reshaped_view<const Spack*>();
+  const int ntop_shoc = 0;
+  const int nbot_shoc = m_num_levs;
+  m_npbl = SHF::shoc_init(nbot_shoc,ntop_shoc,pref_mid);
+
+  // WorkspaceManager for internal local variables
+  const int nlevi_packs  = ekat::npack<Spack>(m_num_levs+1);
+  const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
+  const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
+  m_workspace_mgr = std::make_shared<WSM>(m_buffer.wsm_data, nlevi_packs, 13+(n_wind_slots+n_trac_slots), m_policy);
 }
 
 // =========================================================================================
@@ -363,44 +422,43 @@ void SHOCMacrophysics::run_impl (const Real dt)
     it.second.sync_to_host();
   }
 
-  const auto nlev_packs  = ekat::npack<Spack>(m_num_levs);
-  const auto nlevi_packs = ekat::npack<Spack>(m_num_levs+1);
-  const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
-
   // Preprocessing of SHOC inputs
   Kokkos::parallel_for("shoc_preprocess",
-                       policy,
+                       m_policy,
                        shoc_preprocess);
   Kokkos::fence();
 
 
-  // Calculate maximum number of levels in pbl from surface
-  const auto pref_mid = m_shoc_fields_in["pref_mid"].get_reshaped_view<const Spack*>();
-  const int ntop_shoc = 0;
-  const int nbot_shoc = m_num_levs;
-  m_npbl = SHF::shoc_init(nbot_shoc,ntop_shoc,pref_mid);
-
-  // For now set the host timestep to the shoc timestep. This forces
-  // number of SHOC timesteps (nadv) to be 1.
-  // TODO: input parameter?
-  hdtime = dt;
-  m_nadv = ekat::impl::max(hdtime/dt,sp(1));
-
-  // WorkspaceManager for internal local variables
-  const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
-  const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(m_buffer.wsm_data, nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy);
+  // SHOC is sub-stepped m_nadv times within the atm step. The substeps are
+  // all done inside shoc_main's single kernel launch, and the energy fixer
+  // accounts for the whole atm step (nadv*dtime).
+  const Real shoc_dt = dt/m_nadv;
 
   // Run shoc main
-  SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,input,input_output,output,history_output);
+  const auto elapsed = SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, shoc_dt,
+                                      m_policy,*m_workspace_mgr,input,input_output,output,history_output);
 
   // Postprocessing of SHOC outputs
   Kokkos::parallel_for("shoc_postprocess",
-                       policy,
+                       m_policy,
                        shoc_postprocess);
   Kokkos::fence();
 
+  // While tuning the team size, record the time of the slowest rank, and
+  // switch to the next candidate (or to the selected team size).
+  if (m_tuner.is_tuning()) {
+    double max_elapsed = elapsed;
+    MPI_Allreduce(MPI_IN_PLACE, &max_elapsed, 1, MPI_DOUBLE, MPI_MAX, m_shoc_comm.mpi_comm());
+    m_tuner.record(max_elapsed);
+
+    const int nlev_packs   = ekat::npack<Spack>(m_num_levs);
+    const int nlevi_packs  = ekat::npack<Spack>(m_num_levs+1);
+    const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
+    const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
+    m_policy = util::make_team_policy<KT::ExeSpace>(m_num_cols, nlev_packs, m_tuner.team_size(), m_vector_size);
+    m_workspace_mgr = std::make_shared<WSM>(m_buffer.wsm_data, nlevi_packs, 13+(n_wind_slots+n_trac_slots), m_policy);
+  }
+
   // Get a copy of the current timestamp (at the beginning of the step) and
   // advance it, updating the shoc fields.
   auto ts = timestamp();
@@ -413,7 +471,8 @@ void SHOCMacrophysics::run_impl (const Real dt)
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
 {
-  // Do nothing
+  // Release the workspace manager, which holds device views
+  m_workspace_mgr = nullptr;
 }
 // =========================================================================================
 
@@ -6,9 +6,11 @@
 #include "physics/shoc/shoc_main_impl.hpp"
 #include "physics/shoc/shoc_functions.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "share/util/scream_team_size_tuner.hpp"
 #include "share/atm_process/ATMBufferManager.hpp"
 
 #include <string>
+#include <memory>
 
 namespace scream
 {
@@ -418,9 +420,27 @@ protected:
   Int m_num_cols;
   Int m_num_levs;
   Int m_npbl;
-  Int m_nadv;
+  Int m_nadv;  // Number of SHOC substeps per atm step
   Int m_num_tracers;
-  Int hdtime;
+
+  // Team policy and workspace manager for shoc_main (and the pre/post
+  // processing). They are built once, and reused at every step. The team and
+  // vector sizes can be set via the "Team Size" and "Vector Size" parameters
+  // (by default, the policy is the default one for the execution space).
+  // Alternatively, with "Autotune Team Size", the team size is selected at
+  // runtime by timing shoc_main during the first steps, and the choice is
+  // stored in "Tuning Cache File" for later runs. Results depend on the team
+  // size at round-off level (e.g., the team reductions in the energy fixer and
+  // in pblintd_height), so runs that must be BFB should not tune, or set
+  // "Tuning Cache Only" to pin the previously tuned team size.
+  int                  m_team_size;
+  int                  m_vector_size;
+  bool                 m_autotune;
+  std::string          m_tuning_cache_file;
+  bool                 m_tuning_cache_only;
+  util::TeamSizeTuner  m_tuner;
+  KT::TeamPolicy       m_policy;
+  std::shared_ptr<WSM> m_workspace_mgr;
 
   KokkosTypes<DefaultDevice>::view_1d<Real> m_cell_area;
 
@@ -48,15 +48,6 @@ void Functions<S,D>::shoc_assumed_pdf(
   const uview_1d<Spack>&       wthv_sec,
   const uview_1d<Spack>&       shoc_ql2)
 {
-  // Define temporary variables
-  uview_1d<Spack> wthl_sec_zt, wqw_sec_zt, w3_zt,
-                  thl_sec_zt, qwthl_sec_zt, qw_sec_zt;
-  workspace.template take_many_contiguous_unsafe<6>(
-    {"wthl_sec_zt", "wqw_sec_zt", "w3_zt",
-     "thl_sec_zt", "qwthl_sec_zt", "qw_sec_zt"},
-    {&wthl_sec_zt, &wqw_sec_zt, &w3_zt,
-     &thl_sec_zt, &qwthl_sec_zt, &qw_sec_zt});
-
   // Tolerances, thresholds, and constants
   const Scalar thl_tol = 1e-2;
   const Scalar rt_tol = 1e-4;
@@ -73,13 +64,17 @@ void Functions<S,D>::shoc_assumed_pdf(
   const Scalar basetemp = C::basetemp;
   const Scalar epsterm = rair/rv;
 
-  // Interpolate many variables from interface grid to thermo grid
-  linear_interp(team,zi_grid,zt_grid,w3,w3_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,thl_sec,thl_sec_zt,nlevi,nlev,0);
-  linear_interp(team,zi_grid,zt_grid,wthl_sec,wthl_sec_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,qwthl_sec,qwthl_sec_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,wqw_sec,wqw_sec_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,qw_sec,qw_sec_zt,nlevi,nlev,0);
+  // Interface quantities are interpolated to the thermo grid level by level,
+  // inside the main loop below, so that they never go through memory. The
+  // arithmetic is the same as in linear_interp (with nlevi == nlev+1).
+  EKAT_KERNEL_REQUIRE_MSG(nlevi == nlev+1, "Unsupported dimensions for shoc_assumed_pdf");
+  const auto s_zi_grid   = scalarize(zi_grid);
+  const auto s_w3        = scalarize(w3);
+  const auto s_thl_sec   = scalarize(thl_sec);
+  const auto s_wthl_sec  = scalarize(wthl_sec);
+  const auto s_qwthl_sec = scalarize(qwthl_sec);
+  const auto s_wqw_sec   = scalarize(wqw_sec);
+  const auto s_qw_sec    = scalarize(qw_sec);
 
   // The following is morally a const var, but there are issues with
   // gnu and std=c++14. The macro ConstExceptGnu is defined in ekat_kokkos_types.hpp.
@@ -92,16 +87,31 @@ void Functions<S,D>::shoc_assumed_pdf(
 
     const auto pval = pres(k);
 
+    // Interpolate the interface moments to this midpoint
+    auto indx_pack = ekat::range<IntSmallPack>(k*Spack::n + 1);
+    indx_pack.set(indx_pack>=nlevi, nlevi-1);
+    Spack zi_k, zi_km1;
+    ekat::index_and_shift<-1>(s_zi_grid, indx_pack, zi_k, zi_km1);
+    const Spack dz_t = zt_grid(k) - zi_km1;
+    const Spack dz_i = zi_k - zi_km1;
+    const auto interp_to_zt = [&] (const decltype(s_w3)& y, const Scalar minthresh) {
+      Spack y_k, y_km1;
+      ekat::index_and_shift<-1>(y, indx_pack, y_k, y_km1);
+      Spack y_zt = y_km1 + (y_k-y_km1)*dz_t/dz_i;
+      y_zt.set(y_zt < minthresh, minthresh);
+      return y_zt;
+    };
+
     // Get all needed input moments for the PDF at this particular point
     const auto thl_first = thetal(k);
     const auto w_first = w_field(k);
     const auto qw_first = qw(k);
-    const auto w3var = w3_zt(k);
-    const auto thlsec = thl_sec_zt(k);
-    const auto qwsec = qw_sec_zt(k);
-    const auto qwthlsec = qwthl_sec_zt(k);
-    const auto wqwsec = wqw_sec_zt(k);
-    const auto wthlsec = wthl_sec_zt(k);
+    const auto w3var = interp_to_zt(s_w3, largeneg);
+    const auto thlsec = interp_to_zt(s_thl_sec, 0);
+    const auto qwsec = interp_to_zt(s_qw_sec, 0);
+    const auto qwthlsec = interp_to_zt(s_qwthl_sec, largeneg);
+    const auto wqwsec = interp_to_zt(s_wqw_sec, largeneg);
+    const auto wthlsec = interp_to_zt(s_wthl_sec, largeneg);
 
     // Compute square roots of some variables so we don't have to compute these again
     const auto sqrtw2 = ekat::sqrt(w_sec(k));
@@ -340,11 +350,6 @@ void Functions<S,D>::shoc_assumed_pdf(
                    + ((lcond/cp)*ekat::pow(basepres/pval, (rair/cp))
                    - (1/epsterm)*basetemp)*wqls(k);
   });
-
-  // Release temporary variables from the workspace
-  workspace.template release_many_contiguous<6>(
-    {&wthl_sec_zt, &wqw_sec_zt, &w3_zt,
-     &thl_sec_zt, &qwthl_sec_zt, &qw_sec_zt});
 }
 
 } // namespace shoc
@@ -65,6 +65,7 @@ struct Functions
   using uview_2d = typename ekat::template Unmanaged<view_2d<S> >;
 
   using MemberType = typename KT::MemberType;
+  using TeamPolicy = typename KT::TeamPolicy;
 
   using WorkspaceMgr = typename ekat::WorkspaceManager<Spack,  Device>;
   using Workspace    = typename WorkspaceMgr::Workspace;
@@ -627,6 +628,24 @@ struct Functions
     const SHOCOutput&        shoc_output,          // Output
     const SHOCHistoryOutput& shoc_history_output); // Output (diagnostic)
 
+  // Same as above, but shoc_main's kernel is launched with the given team
+  // policy, which must be the one workspace_mgr was built with. This allows
+  // callers to build (and tune) the policy and the workspace manager once.
+  static Int shoc_main(
+    const Int&               shcol,                // Number of SHOC columns in the array
+    const Int&               nlev,                 // Number of levels
+    const Int&               nlevi,                // Number of levels on interface grid
+    const Int&               npbl,                 // Maximum number of levels in pbl from surface
+    const Int&               nadv,                 // Number of times to loop SHOC
+    const Int&               num_q_tracers,        // Number of tracers
+    const Scalar&            dtime,                // SHOC timestep [s]
+    const TeamPolicy&        policy,               // Team policy for the SHOC kernel
+    const WorkspaceMgr&      workspace_mgr,        // WorkspaceManager for local variables
+    const SHOCInput&         shoc_input,           // Input
+    const SHOCInputOutput&   shoc_input_output,    // Input/Output
+    const SHOCOutput&        shoc_output,          // Output
+    const SHOCHistoryOutput& shoc_history_output); // Output (diagnostic)
+
   KOKKOS_FUNCTION
   static void pblintd_height(
     const MemberType& team,
@@ -1,5 +1,6 @@
 #include "shoc_ic_cases.hpp"
 #include "physics_constants.hpp"
+#include "physics_ic_regimes.hpp"
 #include "ekat/ekat_assert.hpp"
 
 namespace scream {
@@ -76,6 +77,13 @@ const std::array<Real, 5> qw_ref = {1e-3*17, 1e-3*16.3, 1e-3*10.7, 1e-3*4.2, 1e-
 const std::array<Real, 5> ql_ref = {0.0, 1e-3*5, 1e-3*7., 1e-3*6., 0.0};
 const std::array<Real, 5> theta_ref = {299.7, 298.7, 302.4, 308.2, 312.85};
 
+// Reference profiles of a column, at the elevations z_ref.
+struct Profile {
+  std::array<Real, 5> qw, ql, theta;
+};
+
+const Profile standard_profile = {qw_ref, ql_ref, theta_ref};
+
 // Wind speed interpolation data.
 const std::array<Real, 3> wind_z_ref = {0.0, 700.0, 3000.0};
 const std::array<Real, 3> u_ref = {-7.75, -8.75, -4.61};
@@ -109,7 +117,7 @@ Real interpolate_data(const std::array<Real, N>& ref_elevations,
 // Calculates hydrostatic pressure for a specific column given elevation
 // data.
 void compute_column_pressure(Int col, Int nlev, const Array2& z,
-                             Array2& pres) {
+                             Array2& pres, const Profile& profile = standard_profile) {
   using consts = scream::physics::Constants<Real>;
   const Int i = col;
   const Real k = consts::Rair / consts::Cpair;
@@ -120,8 +128,8 @@ void compute_column_pressure(Int col, Int nlev, const Array2& z,
   for (Int j = 0; j < nlev; ++j) {
     Real z0 = (j == 0) ? 0.0 : z(i, j-1);
     Real z1 = z(i, j);
-    Real th0 = interpolate_data(z_ref, theta_ref, z0);
-    Real th1 = interpolate_data(z_ref, theta_ref, z1);
+    Real th0 = interpolate_data(z_ref, profile.theta, z0);
+    Real th1 = interpolate_data(z_ref, profile.theta, z1);
     Real p0 = (j == 0) ? p_s : pres(i, j-1);
     if (std::abs(th0 - th1) < 1e-14 * th0) {
       pres(i, j) = pow(pow(p0, k) + k*c*(z1 - z0)/th0, 1.0/k);
@@ -222,12 +230,146 @@ FortranData::Ptr make_standard(const Int shcol, Int nlev, Int num_qtracers) {
   return dp;
 }
 
+// Reference profiles and surface fluxes for a column in the given regime.
+// The standard case is used for stratocumulus, while the other regimes
+// change the PBL depth and stability, and the amount of condensate.
+struct RegimeColumn {
+  Profile profile;
+  Real wthl_sfc, wqw_sfc, wind_scale;
+};
+
+RegimeColumn make_regime_column(const physics::ColumnRegime& c) {
+  using physics::Regime;
+
+  const Real a = c.strength;
+  RegimeColumn rc;
+  switch (c.regime) {
+    case Regime::ClearSky:
+      // Dry convective boundary layer, well mixed up to ~1km
+      rc.profile.qw    = {1e-3*10, 1e-3*9.8, 1e-3*6, 1e-3*4, 1e-3*3};
+      rc.profile.ql    = {0.0, 0.0, 0.0, 0.0, 0.0};
+      rc.profile.theta = {300.0, 300.0 + 0.5*a, 303.0, 306.0, 311.0};
+      rc.wthl_sfc = 5e-2*(0.5 + a);
+      rc.wqw_sfc  = 2e-5;
+      rc.wind_scale = 0.5;
+      break;
+    case Regime::Stratocumulus:
+      rc.profile = standard_profile;
+      for (auto& ql : rc.profile.ql) {
+        ql *= 0.5 + a;
+      }
+      rc.wthl_sfc = 1e-4;
+      rc.wqw_sfc  = 1e-6;
+      rc.wind_scale = 1.0;
+      break;
+    case Regime::DeepConvection:
+      // Moist, conditionally unstable column, cloudy above ~500m
+      rc.profile.qw    = {1e-3*18, 1e-3*17.5, 1e-3*15, 1e-3*13, 1e-3*10};
+      rc.profile.ql    = {0.0, 1e-3*(0.5 + a), 1e-3*(1.0 + a), 1e-3*(1.0 + a), 1e-3*0.5};
+      rc.profile.theta = {301.0, 300.5, 301.5, 303.0, 305.0};
+      rc.wthl_sfc = 2e-2;
+      rc.wqw_sfc  = 1e-4*(0.5 + a);
+      rc.wind_scale = 1.5;
+      break;
+    case Regime::PolarIce:
+      // Cold, stably stratified boundary layer, with little condensate
+      rc.profile.qw    = {1e-3*1.5, 1e-3*1.4, 1e-3*1.2, 1e-3*1.0, 1e-3*0.8};
+      rc.profile.ql    = {0.0, 1e-3*0.05*(0.5 + a), 1e-3*0.05, 0.0, 0.0};
+      rc.profile.theta = {255.0, 258.0 + 2*a, 262.0, 265.0, 268.0};
+      rc.wthl_sfc = -1e-2;
+      rc.wqw_sfc  = 0;
+      rc.wind_scale = 0.7;
+      break;
+    default:
+      EKAT_ERROR_MSG("Error! Unhandled regime " + physics::e2str(c.regime) + ".\n");
+  }
+  return rc;
+}
+
+FortranData::Ptr make_regimes(const Int shcol, Int nlev, Int num_qtracers, const unsigned seed) {
+  using consts = scream::physics::Constants<Real>;
+
+  const auto dp = std::make_shared<FortranData>(shcol, nlev, nlev+1,
+                                                num_qtracers);
+
+  auto& d = *dp;
+
+  const auto regimes = physics::sample_column_regimes(shcol, physics::default_regime_weights(), seed);
+
+  const Real ztop = 2400.0;
+  const Real dz = ztop/nlev;
+  for (Int i = 0; i < shcol; ++i) {
+    const auto rc = make_regime_column(regimes[i]);
+
+    d.host_dx(i) = 5300.0;
+    d.host_dy(i) = 5300.0;
+
+    d.zi_grid(i, 0) = 0;
+    for (Int k = 0; k < nlev; ++k) {
+      Real zi0 = k * dz;
+      Real zi1 = (k+1) * dz;
+      d.zi_grid(i, k+1) = zi1;
+      Real zt = 0.5 * (zi0 + zi1);
+      d.zt_grid(i, k) = zt;
+
+      const Real theta_zt = interpolate_data(z_ref, rc.profile.theta, zt);
+      const Real qw = interpolate_data(z_ref, rc.profile.qw, zt);
+      const Real ql = interpolate_data(z_ref, rc.profile.ql, zt);
+      d.qw(i, k) = qw;
+      d.shoc_ql(i, k) = ql;
+      Real zvir = (consts::RH2O / consts::Rair) - 1.0;
+      d.thv(i, k) = theta_zt * (1.0 + zvir * qw);
+      d.thetal(i, k) = theta_zt;
+
+      d.u_wind(i, k) = rc.wind_scale*interpolate_data(wind_z_ref, u_ref, zt);
+      d.v_wind(i, k) = rc.wind_scale*interpolate_data(wind_z_ref, v_ref, zt);
+      d.w_field(i, k) = interpolate_data(wind_z_ref, w_ref, zt);
+
+      d.tke(i, k) = 0;
+
+      for (Int q = 0; q < d.num_qtracers; ++q)
+      {
+        d.qtracers(i, k, q) = sin(q/3. + 0.1 * zt * 0.2 * (i+1));
+        d.wtracer_sfc(i, q) = 0.1 * i;
+      }
+    }
+
+    d.wthl_sfc[i] = rc.wthl_sfc;
+    d.wqw_sfc[i] = rc.wqw_sfc;
+    d.uw_sfc[i] = 1e-2*rc.wind_scale;
+    d.vw_sfc[i] = 1e-4*rc.wind_scale;
+
+    compute_column_pressure(i, d.nlev, d.zt_grid, d.pres, rc.profile);
+    compute_column_pressure(i, d.nlevi, d.zi_grid, d.presi, rc.profile);
+
+    for (Int k = 0; k < nlev; ++k) {
+      d.pdel(i, k) = std::abs(d.presi(i, k+1) - d.presi(i, k));
+      d.exner(i, k) = pow(d.pres(i, k)/consts::P0, consts::Rair/consts::Cpair);
+      d.host_dse(i, k) = consts::Cpair * d.exner(i, k) * d.thv(i, k) +
+                         consts::gravit * d.zt_grid(i, k);
+    }
+
+    d.phis(i) = 0;
+    for (Int k = 0; k < nlev; ++k) {
+      d.wthv_sec(i, k) = 0;
+      d.tk(i, k) = 0;
+      d.tkh(i, k) = 0;
+    }
+  }
+
+  // Flip the data to match SHOC's vertical indexing.
+  flip_vertically(d);
+
+  return dp;
+}
+
 } // end anonymous namespace
 
 // From scream-docs/shoc-port/shocintr.py.
 FortranData::Ptr Factory::create (IC ic, Int shcol, Int nlev, Int num_qtracers) {
   switch (ic) {
     case standard: return make_standard(shcol, nlev, num_qtracers);
+    case regimes:  return make_regimes(shcol, nlev, num_qtracers, 0);
     default: EKAT_REQUIRE_MSG(false, "Not an IC: " << ic);
   }
 }
@@ -8,7 +8,9 @@ namespace shoc {
 namespace ic {
 
 struct Factory {
-  enum IC { standard };
+  // standard: from scream-docs/shoc-port/shocintr.py
+  // regimes:  columns sampled from a mix of regimes (see physics_ic_regimes.hpp)
+  enum IC { standard, regimes };
   static FortranData::Ptr create(IC ic, Int shcol = 1, Int nlev = 72,
                                  Int num_qtracers = 1);
 };
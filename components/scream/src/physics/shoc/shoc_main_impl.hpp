@@ -304,12 +304,33 @@ Int Functions<S,D>::shoc_main(
 {
   using ExeSpace = typename KT::ExeSpace;
 
+  const auto nlev_packs = ekat::npack<Spack>(nlev);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+
+  return shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime, policy, workspace_mgr,
+                   shoc_input, shoc_input_output, shoc_output, shoc_history_output);
+}
+
+template<typename S, typename D>
+Int Functions<S,D>::shoc_main(
+  const Int&               shcol,               // Number of SHOC columns in the array
+  const Int&               nlev,                // Number of levels
+  const Int&               nlevi,               // Number of levels on interface grid
+  const Int&               npbl,                // Maximum number of levels in pbl from surface
+  const Int&               nadv,                // Number of times to loop SHOC
+  const Int&               num_qtracers,        // Number of tracers
+  const Scalar&            dtime,               // SHOC timestep [s]
+  const TeamPolicy&        policy,              // Team policy for the SHOC kernel
+  const WorkspaceMgr&      workspace_mgr,       // WorkspaceManager for local variables
+  const SHOCInput&         shoc_input,          // Input
+  const SHOCInputOutput&   shoc_input_output,   // Input/Output
+  const SHOCOutput&        shoc_output,         // Output
+  const SHOCHistoryOutput& shoc_history_output) // Output (diagnostic)
+{
   // Start timer
   auto start = std::chrono::steady_clock::now();
 
   // SHOC main loop
-  const auto nlev_packs = ekat::npack<Spack>(nlev);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
 
@@ -100,9 +100,10 @@ static Int compare (const std::string& label, const Scalar* a,
 
 struct Baseline {
 
-  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int num_qtracers, const Int nadv, const Int repeat)
+  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int num_qtracers, const Int nadv, const Int repeat,
+            const ic::Factory::IC ic)
   {
-    params_.push_back({ic::Factory::standard, repeat, nsteps, ncol, nlev, num_qtracers, nadv, dt});
+    params_.push_back({ic, repeat, nsteps, ncol, nlev, num_qtracers, nadv, dt});
   }
 
   Int generate_baseline (const std::string& filename, bool use_fortran) {
@@ -248,7 +249,8 @@ int main (int argc, char** argv) {
       "  -k <nlev>         Number of vertical levels. Default=72.\n"
       "  -q <num_qtracers> Number of q tracers. Default=3.\n"
       "  -n <nadv>         Number of SHOC loops per timestep. Default=15.\n"
-      "  -r <repeat>       Number of repetitions, implies timing run (generate + no I/O). Default=0.\n";
+      "  -r <repeat>       Number of repetitions, implies timing run (generate + no I/O). Default=0.\n"
+      "  -ic <ic>          Initial condition: standard|regimes. Default=standard.\n";
 
     return 1;
   }
@@ -262,6 +264,7 @@ int main (int argc, char** argv) {
   Int num_qtracers = 3;
   Int nadv = 15;
   Int repeat = 0;
+  ic::Factory::IC ic = ic::Factory::standard;
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
     if (ekat::argv_matches(argv[i], "-f", "--fortran")) use_fortran = true;
@@ -308,6 +311,14 @@ int main (int argc, char** argv) {
         generate = true;
       }
     }
+    if (ekat::argv_matches(argv[i], "-ic", "--ic")) {
+      expect_another_arg(i, argc);
+      ++i;
+      const std::string ic_name(argv[i]);
+      EKAT_REQUIRE_MSG(ic_name == "standard" || ic_name == "regimes",
+                       "Initial condition must be one of standard|regimes");
+      ic = ic_name == "standard" ? ic::Factory::standard : ic::Factory::regimes;
+    }
   }
 
   // Decorate baseline name with precision.
@@ -315,7 +326,7 @@ int main (int argc, char** argv) {
   baseline_fn += std::to_string(sizeof(scream::Real));
 
   scream::initialize_scream_session(argc, argv); {
-    Baseline bln(nsteps, static_cast<Real>(dt), ncol, nlev, num_qtracers, nadv, repeat);
+    Baseline bln(nsteps, static_cast<Real>(dt), ncol, nlev, num_qtracers, nadv, repeat, ic);
     if (generate) {
       std::cout << "Generating to " << baseline_fn << "\n";
       nerr += bln.generate_baseline(baseline_fn, use_fortran);
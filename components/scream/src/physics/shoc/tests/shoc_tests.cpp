@@ -2,6 +2,7 @@
 
 #include "physics/shoc/shoc_f90.hpp"
 #include "physics/shoc/shoc_ic_cases.hpp"
+#include "physics/share/physics_ic_regimes.hpp"
 
 #include "ekat/util/ekat_test_utils.hpp"
 
@@ -66,5 +67,30 @@ TEST_CASE("shoc_ic_c", "shoc") {
   REQUIRE(nerr == 0);
 }
 
+TEST_CASE("shoc_ic_regimes", "shoc") {
+  using scream::shoc::ic::Factory;
+  using scream::physics::Regime;
+
+  const int shcol = 16, nlev = 72;
+  const auto regimes = scream::physics::sample_column_regimes(shcol);
+  const auto d = Factory::create(Factory::regimes, shcol, nlev, 1);
+
+  for (int i = 0; i < shcol; ++i) {
+    bool has_ql = false;
+    for (int k = 0; k < nlev; ++k) {
+      has_ql = has_ql || d->shoc_ql(i,k) > 0;
+      REQUIRE(d->pdel(i,k) > 0);
+    }
+    REQUIRE(has_ql == (regimes[i].regime != Regime::ClearSky));
+    REQUIRE((d->wthl_sfc(i) < 0) == (regimes[i].regime == Regime::PolarIce));
+  }
+
+  // Make sure SHOC can run on it
+  scream::shoc::shoc_init(nlev, false, true);
+  d->nadv = 10;
+  d->dtime = 10;
+  scream::shoc::shoc_main(*d, false);
+}
+
 } // anonymous namespace
 
@@ -15,6 +15,9 @@ namespace scream
  * The AD should store exactly ONE instance of this class stored
  * in its list of subcomponents (the AD should make sure of this).
  *
+ * Note: ZM still runs the fortran zm_convr on host (fields are synced to
+ * host and back at every step). The C++ port in zm_functions.hpp is not
+ * complete yet (see the list of routines to be ported there).
 */
 
 class ZMDeepConvection : public AtmosphereProcess
@@ -0,0 +1,261 @@
+#include "catch2/catch.hpp"
+
+#include "zm_unit_tests_common.hpp"
+#include "physics/zm/zm_functions.hpp"
+#include "physics/zm/zm_functions_f90.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_arch.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <random>
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestEntropy {
+
+  static void run_property()
+  {
+    static constexpr Int npts = 5;
+
+    // Tests for the ZM function:
+    //   entropy
+
+    // Temperature [K], increasing
+    static constexpr Real tk[npts] = {240, 260, 280, 300, 310};
+    // Pressure [hPa]
+    static constexpr Real p = 800;
+    // Total water [kg/kg]
+    static constexpr Real qtot = 5e-3;
+
+    EntropyData d(npts);
+    for (Int i = 0; i < npts; ++i) {
+      d.tk[i] = tk[i];
+      d.p[i] = p;
+      d.qtot[i] = qtot;
+    }
+
+    // Call the fortran implementation
+    entropy(d);
+
+    // At fixed pressure and total water, the entropy increases with the temperature
+    for (Int i = 0; i < npts-1; ++i) {
+      REQUIRE(d.entropy[i+1] > d.entropy[i]);
+    }
+
+    // At fixed temperature and (unsaturated) total water, the entropy decreases with the pressure
+    static constexpr Real p_test2[npts] = {200, 400, 600, 850, 1000};
+    for (Int i = 0; i < npts; ++i) {
+      d.tk[i] = 290;
+      d.p[i] = p_test2[i];
+      d.qtot[i] = 1e-4;
+    }
+    entropy(d);
+    for (Int i = 0; i < npts-1; ++i) {
+      REQUIRE(d.entropy[i+1] < d.entropy[i]);
+    }
+  }
+
+  static void run_bfb()
+  {
+    EntropyData f90_data[] = {
+      //          npts
+      EntropyData(10),
+      EntropyData(25),
+      EntropyData(1),
+      EntropyData(64)
+    };
+
+    // Generate random input data, in realistic ranges for the troposphere
+    for (auto& d : f90_data) {
+      d.randomize({ {d.tk, {200, 310}}, {d.p, {100, 1000}}, {d.qtot, {1e-6, 2e-2}} });
+    }
+
+    // Create copies of data for use by cxx. Needs to happen before fortran calls so that
+    // inout data is in original state
+    EntropyData cxx_data[] = {
+      EntropyData(f90_data[0]),
+      EntropyData(f90_data[1]),
+      EntropyData(f90_data[2]),
+      EntropyData(f90_data[3])
+    };
+
+    // Get data from fortran
+    for (auto& d : f90_data) {
+      entropy(d);
+    }
+
+    // Get data from cxx. All data is one dimensional, so there is no need to transpose
+    for (auto& d : cxx_data) {
+      entropy_f(d.npts, d.tk, d.p, d.qtot, d.entropy);
+    }
+
+    // Verify BFB results
+#ifndef NDEBUG
+    static constexpr Int num_runs = sizeof(f90_data) / sizeof(EntropyData);
+    for (Int i = 0; i < num_runs; ++i) {
+      EntropyData& d_f90 = f90_data[i];
+      EntropyData& d_cxx = cxx_data[i];
+      for (Int k = 0; k < d_f90.npts; ++k) {
+        REQUIRE(d_f90.entropy[k] == d_cxx.entropy[k]);
+      }
+    }
+#endif
+  }
+};
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestIentropy {
+
+  static void run_property()
+  {
+    static constexpr Int npts = 6;
+
+    // Tests for the ZM function:
+    //   ientropy
+
+    // Temperature [K]
+    static constexpr Real tk[npts] = {220, 250, 270, 285, 295, 305};
+    // Pressure [hPa]
+    static constexpr Real p[npts] = {200, 400, 600, 850, 950, 1000};
+    // Total water [kg/kg], from unsaturated to supersaturated
+    static constexpr Real qt[npts] = {1e-5, 1e-4, 1e-3, 2e-2, 1e-2, 3e-2};
+    // Offset of the first guess from the actual temperature [K]
+    static constexpr Real dtfg[npts] = {0, 5, -5, 8, -2, 1};
+
+    // Compute the entropy of each state
+    EntropyData ed(npts);
+    for (Int i = 0; i < npts; ++i) {
+      ed.tk[i] = tk[i];
+      ed.p[i] = p[i];
+      ed.qtot[i] = qt[i];
+    }
+    entropy(ed);
+
+    // Invert it, starting from a first guess within the bracket
+    IentropyData d(npts);
+    for (Int i = 0; i < npts; ++i) {
+      d.s[i] = ed.entropy[i];
+      d.p[i] = p[i];
+      d.qt[i] = qt[i];
+      d.tfg[i] = tk[i] + dtfg[i];
+    }
+
+    // Call the fortran implementation
+    ientropy(d);
+
+    for (Int i = 0; i < npts; ++i) {
+      // The inversion recovers the temperature within the tolerance of Brent's method
+      REQUIRE(std::abs(d.t[i] - tk[i]) < 0.01);
+
+      // The saturation mixing ratio is positive, and consistent with the temperature
+      Real es, qs;
+      Functions::qsat_hPa(d.t[i], d.p[i], es, qs);
+      REQUIRE(d.qst[i] > 0);
+      REQUIRE(std::abs(d.qst[i] - qs) <= 1e-10*qs);
+    }
+  }
+
+  static void run_bfb()
+  {
+    IentropyData f90_data[] = {
+      //           npts
+      IentropyData(10),
+      IentropyData(25),
+      IentropyData(1),
+      IentropyData(64)
+    };
+
+    // Generate the entropy of random states, in realistic ranges for the troposphere,
+    // and random first guesses within 8 K of the temperature of the state.
+    std::default_random_engine generator;
+    std::uniform_real_distribution<Real> dtfg_dist(-8, 8);
+    for (auto& d : f90_data) {
+      d.randomize({ {d.tfg, {200, 310}}, {d.p, {100, 1000}}, {d.qt, {1e-6, 2e-2}} });
+
+      EntropyData ed(d.npts);
+      for (Int i = 0; i < d.npts; ++i) {
+        ed.tk[i] = d.tfg[i];
+        ed.p[i] = d.p[i];
+        ed.qtot[i] = d.qt[i];
+      }
+      entropy(ed);
+
+      for (Int i = 0; i < d.npts; ++i) {
+        d.s[i] = ed.entropy[i];
+        d.tfg[i] += dtfg_dist(generator);
+      }
+    }
+
+    // Create copies of data for use by cxx. Needs to happen before fortran calls so that
+    // inout data is in original state
+    IentropyData cxx_data[] = {
+      IentropyData(f90_data[0]),
+      IentropyData(f90_data[1]),
+      IentropyData(f90_data[2]),
+      IentropyData(f90_data[3])
+    };
+
+    // Get data from fortran
+    for (auto& d : f90_data) {
+      ientropy(d);
+    }
+
+    // Get data from cxx. All data is one dimensional, so there is no need to transpose
+    for (auto& d : cxx_data) {
+      ientropy_f(d.npts, d.s, d.p, d.qt, d.tfg, d.t, d.qst);
+    }
+
+    // Verify BFB results
+#ifndef NDEBUG
+    static constexpr Int num_runs = sizeof(f90_data) / sizeof(IentropyData);
+    for (Int i = 0; i < num_runs; ++i) {
+      IentropyData& d_f90 = f90_data[i];
+      IentropyData& d_cxx = cxx_data[i];
+      for (Int k = 0; k < d_f90.npts; ++k) {
+        REQUIRE(d_f90.t[k] == d_cxx.t[k]);
+        REQUIRE(d_f90.qst[k] == d_cxx.qst[k]);
+      }
+    }
+#endif
+  }
+};
+
+}  // namespace unit_test
+}  // namespace zm
+}  // namespace scream
+
+namespace {
+
+TEST_CASE("zm_entropy_property", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestEntropy;
+
+  TestStruct::run_property();
+}
+
+TEST_CASE("zm_entropy_bfb", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestEntropy;
+
+  TestStruct::run_bfb();
+}
+
+TEST_CASE("zm_ientropy_property", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestIentropy;
+
+  TestStruct::run_property();
+}
+
+TEST_CASE("zm_ientropy_bfb", "zm")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestIentropy;
+
+  TestStruct::run_bfb();
+}
+
+} // namespace
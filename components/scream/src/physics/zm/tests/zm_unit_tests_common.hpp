@@ -0,0 +1,54 @@
+#ifndef ZM_UNIT_TESTS_COMMON_HPP
+#define ZM_UNIT_TESTS_COMMON_HPP
+
+#include "physics/zm/zm_functions.hpp"
+#include "share/scream_types.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+/*
+ * Unit test infrastructure for zm unit tests.
+ *
+ * zm entities can friend scream::zm::unit_test::UnitWrap to give unit tests
+ * access to private members.
+ *
+ * All unit test impls should be within an inner struct of UnitWrap::UnitTest for
+ * easy access to useful types.
+ */
+
+struct UnitWrap {
+
+  template <typename D=DefaultDevice>
+  struct UnitTest : public KokkosTypes<D> {
+
+    using Device      = D;
+    using MemberType  = typename KokkosTypes<Device>::MemberType;
+    using TeamPolicy  = typename KokkosTypes<Device>::TeamPolicy;
+    using RangePolicy = typename KokkosTypes<Device>::RangePolicy;
+    using ExeSpace    = typename KokkosTypes<Device>::ExeSpace;
+
+    template <typename S>
+    using view_1d = typename KokkosTypes<Device>::template view_1d<S>;
+    template <typename S>
+    using view_2d = typename KokkosTypes<Device>::template view_2d<S>;
+
+    using Functions          = scream::zm::Functions<Real, Device>;
+    using Scalar             = typename Functions::Scalar;
+    using C                  = typename Functions::C;
+    using ZC                 = typename Functions::ZC;
+
+    // Put struct decls here
+    struct TestEntropy;
+    struct TestIentropy;
+  };
+
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+#endif
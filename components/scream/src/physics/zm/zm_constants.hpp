@@ -0,0 +1,32 @@
+#ifndef ZM_CONSTANTS_HPP
+#define ZM_CONSTANTS_HPP
+
+namespace scream {
+  namespace zm {
+
+    /*
+     * Physical constants used by ZM. These are the values hardcoded
+     * in zm_conv.F90, which differ slightly from physics::Constants
+     * (e.g., rair, rh2o). The fortran initializes them with default
+     * (single precision) real literals, so the same is done here,
+     * so that the C++ port is BFB with the fortran.
+     */
+
+template <typename Scalar>
+struct Constants
+  {
+    static constexpr Scalar cpair   = 1004.64f;          // Specific heat of dry air [J/kg/K]
+    static constexpr Scalar rh2o    = 461.504639820160f; // Gas constant of water vapor [J/kg/K]
+    static constexpr Scalar rair    = 287.042311365049f; // Gas constant of dry air [J/kg/K]
+    static constexpr Scalar latvap  = 2501000.0f;        // Latent heat of vaporization [J/kg]
+    static constexpr Scalar tmelt   = 273.15f;           // Freezing point of water [K]
+    static constexpr Scalar cpliq   = 4188.0f;           // Specific heat of liquid water [J/kg/K]
+    static constexpr Scalar cpwv    = 1.810e3f;          // Specific heat of water vapor [J/kg/K]
+    static constexpr Scalar epsilo  = 18.016f/28.966f;   // Ratio of molecular mass of water to dry air
+    static constexpr Scalar pref    = 1000.0;            // Reference pressure for the entropy [hPa]
+  };
+
+  } // namespace zm
+} // namespace scream
+
+#endif
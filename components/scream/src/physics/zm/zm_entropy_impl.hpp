@@ -0,0 +1,160 @@
+#ifndef ZM_ENTROPY_IMPL_HPP
+#define ZM_ENTROPY_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+#include "ekat/util/ekat_math_utils.hpp"
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm qsat_hPa, entropy and ientropy. Clients should NOT
+ * #include this file, but include zm_functions.hpp instead.
+ *
+ * These are the thermodynamics of the dilute plume (parcel_dilute):
+ * the parcel conserves its entropy while mixing with the environment,
+ * and the temperature of the parcel is recovered by inverting the entropy.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::qsat_hPa(
+  const Scalar& t,
+  const Scalar& p,
+  Scalar&       es,
+  Scalar&       qm)
+{
+  // Flatau et al. 1992, table 4 (right-hand column), w.r.t. liquid
+  static constexpr Scalar a0 =  6.11239921;
+  static constexpr Scalar a1 =  0.443987641;
+  static constexpr Scalar a2 =  0.142986287e-1;
+  static constexpr Scalar a3 =  0.264847430e-3;
+  static constexpr Scalar a4 =  0.302950461e-5;
+  static constexpr Scalar a5 =  0.206739458e-7;
+  static constexpr Scalar a6 =  0.640689451e-10;
+  static constexpr Scalar a7 = -0.952447341e-13;
+  static constexpr Scalar a8 = -0.976195544e-15;
+
+  // The saturation is computed in Pa, and es converted back to hPa
+  const Scalar p_pa = p*100;
+  const Scalar dt = ekat::impl::max<Scalar>(-80, t-Scalar(273.15));
+  es = a0 + dt*(a1+dt*(a2+dt*(a3+dt*(a4+dt*(a5+dt*(a6+dt*(a7+a8*dt)))))));
+  es = es*100;
+  qm = ZC::epsilo*es/ekat::impl::max<Scalar>(1.e-3, p_pa-es);
+  es = es*Scalar(0.01);
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Scalar
+Functions<S,D>::entropy(
+  const Scalar& tk,
+  const Scalar& p,
+  const Scalar& qtot)
+{
+  const Scalar L = ZC::latvap - (ZC::cpliq - ZC::cpwv)*(tk-ZC::tmelt);
+
+  Scalar est, qst;
+  qsat_hPa(tk, p, est, qst);
+
+  // Partition qtot into vapor part only
+  const Scalar qv = ekat::impl::min(qtot, qst);
+  const Scalar e  = qv*p / (ZC::epsilo + qv);
+
+  return (ZC::cpair + qtot*ZC::cpliq)*std::log(tk/ZC::tmelt) - ZC::rair*std::log((p-e)/ZC::pref) +
+         L*qv/tk - qv*ZC::rh2o*std::log(qv/qst);
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::ientropy(
+  const Scalar& s,
+  const Scalar& p,
+  const Scalar& qt,
+  const Scalar& tfg,
+  Scalar&       t,
+  Scalar&       qst)
+{
+  // Max number of iteration loops
+  static constexpr Int    loopmax = 100;
+  static constexpr Scalar eps     = 3.e-8;
+  static constexpr Scalar tol     = 0.001;
+
+  // Invert the entropy equation -- use Brent's method
+  // Brent, R. P. Ch. 3-4 in Algorithms for Minimization Without Derivatives. Englewood Cliffs, NJ: Prentice-Hall, 1973.
+  Scalar a = tfg-10; // low bracket
+  Scalar b = tfg+10; // high bracket
+
+  Scalar fa = entropy(a, p, qt) - s;
+  Scalar fb = entropy(b, p, qt) - s;
+
+  Scalar c  = b;
+  Scalar fc = fb;
+  Scalar d = 0, ebr = 0;
+
+  for (Int i = 0; i <= loopmax; ++i) {
+    if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+      c   = a;
+      fc  = fa;
+      d   = b-a;
+      ebr = d;
+    }
+    if (std::abs(fc) < std::abs(fb)) {
+      a  = b;
+      b  = c;
+      c  = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+
+    const Scalar tol1 = 2*eps*std::abs(b) + Scalar(0.5)*tol;
+    const Scalar xm   = Scalar(0.5)*(c-b);
+    if (std::abs(xm) <= tol1 || fb == 0) {
+      break;
+    }
+
+    if (std::abs(ebr) >= tol1 && std::abs(fa) > std::abs(fb)) {
+      const Scalar sbr = fb/fa;
+      Scalar pbr, qbr;
+      if (a == c) {
+        pbr = 2*xm*sbr;
+        qbr = 1-sbr;
+      } else {
+        qbr = fa/fc;
+        const Scalar rbr = fb/fc;
+        pbr = sbr*(2*xm*qbr*(qbr-rbr)-(b-a)*(rbr-1));
+        qbr = (qbr-1)*(rbr-1)*(sbr-1);
+      }
+      if (pbr > 0) {
+        qbr = -qbr;
+      }
+      pbr = std::abs(pbr);
+      if (2*pbr < ekat::impl::min(3*xm*qbr-std::abs(tol1*qbr), std::abs(ebr*qbr))) {
+        ebr = d;
+        d   = pbr/qbr;
+      } else {
+        d   = xm;
+        ebr = d;
+      }
+    } else {
+      d   = xm;
+      ebr = d;
+    }
+    a  = b;
+    fa = fb;
+    b  = b + (std::abs(d) > tol1 ? d : (xm >= 0 ? tol1 : -tol1));
+
+    fb = entropy(b, p, qt) - s;
+  }
+
+  t = b;
+  Scalar est;
+  qsat_hPa(t, p, est, qst);
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
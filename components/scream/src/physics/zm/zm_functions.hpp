@@ -0,0 +1,127 @@
+#ifndef ZM_FUNCTIONS_HPP
+#define ZM_FUNCTIONS_HPP
+
+#include "physics/share/physics_constants.hpp"
+#include "physics/zm/zm_constants.hpp"
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack_kokkos.hpp"
+#include "ekat/ekat_workspace.hpp"
+
+namespace scream {
+namespace zm {
+
+/*
+ * Functions is a stateless struct used to encapsulate a
+ * number of functions for ZM. We use the ETI pattern for
+ * these functions.
+ *
+ * This is the groundwork for the C++ port of zm_conv.F90, which is
+ * done one routine at a time, with BFB unit tests against the fortran
+ * for each routine (see tests/). The port is INCOMPLETE, and ZM does
+ * not run on device yet: so far, only the thermodynamics of the dilute
+ * plume (qsat_hPa, entropy and its inversion) is available, and nothing
+ * outside the unit tests calls it. The routines still to be ported are:
+ *  - buoyan_dilute and parcel_dilute (parcel ascent and CAPE)
+ *  - cldprp (updraft/downdraft properties)
+ *  - closure (cloud base mass flux)
+ *  - q1q2_pjr (heating and moistening tendencies)
+ *  - zm_conv_evap (evaporation of precipitation)
+ *  - convtran and momtran (convective transport of tracers and momentum)
+ * Until then, ZMDeepConvection calls the fortran zm_convr, on host.
+ *
+ * ZM assumptions:
+ *  - Kokkos team policies have a vector length of 1
+ *  - The parcel ascent is sequential in the vertical, so the plume
+ *    routines work on scalars, one column per team.
+ */
+
+template <typename ScalarT, typename DeviceT>
+struct Functions
+{
+  //
+  // ------- Types --------
+  //
+
+  using Scalar = ScalarT;
+  using Device = DeviceT;
+
+  template <typename S>
+  using BigPack = ekat::Pack<S,SCREAM_PACK_SIZE>;
+  template <typename S>
+  using SmallPack = ekat::Pack<S,SCREAM_SMALL_PACK_SIZE>;
+
+  using IntSmallPack = SmallPack<Int>;
+  using Pack = BigPack<Scalar>;
+  using Spack = SmallPack<Scalar>;
+
+  using Mask  = ekat::Mask<Pack::n>;
+  using Smask = ekat::Mask<Spack::n>;
+
+  using KT = ekat::KokkosTypes<Device>;
+
+  using C  = physics::Constants<Scalar>;
+  using ZC = zm::Constants<Scalar>;
+
+  template <typename S>
+  using view_1d = typename KT::template view_1d<S>;
+  template <typename S>
+  using view_2d = typename KT::template view_2d<S>;
+
+  template <typename S>
+  using uview_1d = typename ekat::template Unmanaged<view_1d<S> >;
+
+  template <typename S>
+  using uview_2d = typename ekat::template Unmanaged<view_2d<S> >;
+
+  using MemberType = typename KT::MemberType;
+  using TeamPolicy = typename KT::TeamPolicy;
+
+  using WorkspaceMgr = typename ekat::WorkspaceManager<Spack,  Device>;
+  using Workspace    = typename WorkspaceMgr::Workspace;
+
+  //
+  // --------- Functions ---------
+  //
+
+  // Saturation vapor pressure es [hPa] and mixing ratio qm [kg/kg], w.r.t. liquid,
+  // at temperature t [K] and pressure p [hPa]
+  KOKKOS_FUNCTION
+  static void qsat_hPa(
+    const Scalar& t,
+    const Scalar& p,
+    Scalar&       es,
+    Scalar&       qm);
+
+  // Entropy [J/kg/K] of moist air at temperature tk [K], pressure p [hPa],
+  // and total water qtot [kg/kg] (Raymond and Blyth 1992)
+  KOKKOS_FUNCTION
+  static Scalar entropy(
+    const Scalar& tk,
+    const Scalar& p,
+    const Scalar& qtot);
+
+  // Invert the entropy s [J/kg/K] at pressure p [hPa] and total water qt [kg/kg],
+  // for the temperature t [K] and the saturation mixing ratio qst [kg/kg].
+  // tfg [K] is the first guess for t.
+  KOKKOS_FUNCTION
+  static void ientropy(
+    const Scalar& s,
+    const Scalar& p,
+    const Scalar& qt,
+    const Scalar& tfg,
+    Scalar&       t,
+    Scalar&       qst);
+}; // struct Functions
+
+} // namespace zm
+} // namespace scream
+
+// If a GPU build, make all code available to the translation unit; otherwise,
+// ETI is used.
+#ifdef KOKKOS_ENABLE_CUDA
+# include "zm_entropy_impl.hpp"
+#endif // KOKKOS_ENABLE_CUDA
+
+#endif // ZM_FUNCTIONS_HPP
@@ -0,0 +1,122 @@
+#include "zm_functions_f90.hpp"
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include "share/util/scream_deep_copy.hpp"
+
+using scream::Real;
+using scream::Int;
+
+//
+// A C interface to ZM fortran calls. The stubs below will link to fortran definitions in zm_iso_c.f90
+//
+
+extern "C" {
+
+void zm_init_c();
+
+void entropy_c(Real tk, Real p, Real qtot, Real* s);
+
+void ientropy_c(Real s, Real p, Real qt, Real tfg, Real* t, Real* qst);
+
+} // extern "C" : end _c decls
+
+namespace scream {
+namespace zm {
+
+//
+// Glue functions to call fortran from from C++ with the Data struct
+//
+
+void entropy(EntropyData& d)
+{
+  zm_init_c();
+  for (Int i = 0; i < d.npts; ++i) {
+    entropy_c(d.tk[i], d.p[i], d.qtot[i], &d.entropy[i]);
+  }
+}
+
+void ientropy(IentropyData& d)
+{
+  zm_init_c();
+  for (Int i = 0; i < d.npts; ++i) {
+    ientropy_c(d.s[i], d.p[i], d.qt[i], d.tfg[i], &d.t[i], &d.qst[i]);
+  }
+}
+
+//
+// _f function definitions. These expect data in C layout
+//
+
+void entropy_f(Int npts, Real* tk, Real* p, Real* qtot, Real* entropy)
+{
+  using ZMF = Functions<Real, DefaultDevice>;
+
+  using Scalar     = typename ZMF::Scalar;
+  using view_1d    = typename ZMF::view_1d<Scalar>;
+
+  // Sync to device
+  std::vector<view_1d> temp_d(3);
+  std::vector<const Real*> ptr_array = {tk, p, qtot};
+  ScreamDeepCopy::copy_to_device(ptr_array, npts, temp_d);
+
+  // Inputs
+  view_1d
+    tk_d(temp_d[0]),
+    p_d(temp_d[1]),
+    qtot_d(temp_d[2]);
+
+  // Outputs
+  view_1d entropy_d("entropy", npts);
+
+  Kokkos::parallel_for("entropy", npts, KOKKOS_LAMBDA (const int& i) {
+    entropy_d(i) = ZMF::entropy(tk_d(i), p_d(i), qtot_d(i));
+  });
+
+  // Sync back to host
+  std::vector<view_1d> out_views = {entropy_d};
+  ScreamDeepCopy::copy_to_host({entropy}, npts, out_views);
+}
+
+void ientropy_f(Int npts, Real* s, Real* p, Real* qt, Real* tfg, Real* t, Real* qst)
+{
+  using ZMF = Functions<Real, DefaultDevice>;
+
+  using Scalar     = typename ZMF::Scalar;
+  using view_1d    = typename ZMF::view_1d<Scalar>;
+
+  // Sync to device
+  std::vector<view_1d> temp_d(4);
+  std::vector<const Real*> ptr_array = {s, p, qt, tfg};
+  ScreamDeepCopy::copy_to_device(ptr_array, npts, temp_d);
+
+  // Inputs
+  view_1d
+    s_d(temp_d[0]),
+    p_d(temp_d[1]),
+    qt_d(temp_d[2]),
+    tfg_d(temp_d[3]);
+
+  // Outputs
+  view_1d
+    t_d("t", npts),
+    qst_d("qst", npts);
+
+  Kokkos::parallel_for("ientropy", npts, KOKKOS_LAMBDA (const int& i) {
+    Scalar t_s{0};
+    Scalar qst_s{0};
+
+    ZMF::ientropy(s_d(i), p_d(i), qt_d(i), tfg_d(i), t_s, qst_s);
+
+    t_d(i) = t_s;
+    qst_d(i) = qst_s;
+  });
+
+  // Sync back to host
+  std::vector<view_1d> out_views = {t_d, qst_d};
+  ScreamDeepCopy::copy_to_host({t, qst}, npts, out_views);
+}
+
+} // namespace zm
+} // namespace scream
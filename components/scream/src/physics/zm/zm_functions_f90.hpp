@@ -0,0 +1,59 @@
+#ifndef SCREAM_ZM_FUNCTIONS_F90_HPP
+#define SCREAM_ZM_FUNCTIONS_F90_HPP
+
+#include "share/scream_types.hpp"
+#include "physics/share/physics_test_data.hpp"
+
+#include "zm_functions.hpp"
+
+//
+// Bridge functions to call fortran version of zm functions from C++
+//
+
+namespace scream {
+namespace zm {
+
+struct EntropyData : public PhysicsTestData {
+  // Inputs
+  Int npts;
+  Real *tk, *p, *qtot;
+
+  // Outputs
+  Real *entropy;
+
+  EntropyData(Int npts_) :
+    PhysicsTestData({{ npts_ }}, {{ &tk, &p, &qtot, &entropy }}), npts(npts_) {}
+
+  PTD_STD_DEF(EntropyData, 1, npts);
+};
+
+struct IentropyData : public PhysicsTestData {
+  // Inputs
+  Int npts;
+  Real *s, *p, *qt, *tfg;
+
+  // Outputs
+  Real *t, *qst;
+
+  IentropyData(Int npts_) :
+    PhysicsTestData({{ npts_ }}, {{ &s, &p, &qt, &tfg, &t, &qst }}), npts(npts_) {}
+
+  PTD_STD_DEF(IentropyData, 1, npts);
+};
+
+// Glue functions to call fortran from from C++ with the Data struct
+
+void entropy                                        (EntropyData& d);
+void ientropy                                       (IentropyData& d);
+
+extern "C" { // _f function decls
+
+void entropy_f(Int npts, Real* tk, Real* p, Real* qtot, Real* entropy);
+void ientropy_f(Int npts, Real* s, Real* p, Real* qt, Real* tfg, Real* t, Real* qst);
+
+} // end _f function decls
+
+}  // namespace zm
+}  // namespace scream
+
+#endif // SCREAM_ZM_FUNCTIONS_F90_HPP
@@ -0,0 +1,48 @@
+module zm_iso_c
+  use iso_c_binding
+  implicit none
+
+#include "scream_config.f"
+#ifdef SCREAM_DOUBLE_PRECISION
+# define c_real c_double
+#else
+# define c_real c_float
+#endif
+
+!
+! This file contains bridges from scream c++ to zm fortran.
+!
+
+contains
+
+  subroutine zm_init_c() bind(C)
+    use zm_conv, only: zm_convi
+
+    ! The functions ported so far do not depend on the convection top
+    ! level limit, nor on the pbl setting
+    call zm_convi(0, .false.)
+
+  end subroutine zm_init_c
+
+  subroutine entropy_c(tk, p, qtot, s) bind(C)
+    use zm_conv, only: entropy
+
+    real(kind=c_real), intent(in), value :: tk, p, qtot
+    real(kind=c_real), intent(out) :: s
+
+    s = entropy(tk, p, qtot)
+
+  end subroutine entropy_c
+
+  subroutine ientropy_c(s, p, qt, tfg, t, qst) bind(C)
+    use zm_conv, only: ientropy
+
+    real(kind=c_real), intent(in), value :: s, p, qt, tfg
+    real(kind=c_real), intent(out) :: t, qst
+
+    ! rcall, icol and lchnk are only used for diagnostics in the fortran
+    call ientropy(0, 0, 0, s, p, qt, t, qst, tfg)
+
+  end subroutine ientropy_c
+
+end module zm_iso_c
@@ -21,6 +21,9 @@
 #include <string>
 #include <set>
 #include <type_traits>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 namespace scream
 {
@@ -108,7 +111,18 @@ public:
   }
   void run        (const Real dt) {
     // Call the subclass's run method and update it afterward.
-    run_impl(dt);
+    // If timings are enabled, the time spent in run_impl is recorded (see
+    // get_run_timings). We need to fence, so that asynchronous kernels are
+    // accounted for, which is why timings are off by default.
+    if (m_time_runs) {
+      const auto start = std::chrono::steady_clock::now();
+      run_impl(dt);
+      Kokkos::fence();
+      const auto finish = std::chrono::steady_clock::now();
+      m_run_timings.record(std::chrono::duration<double>(finish-start).count());
+    } else {
+      run_impl(dt);
+    }
     t_ += dt;
   }
   void finalize   (/* what inputs? */) {
@@ -212,6 +226,32 @@ public:
     return false;
   }
 
+  // Wall-clock timings (in seconds) of the calls to run. The first call is
+  // stored separately, since it usually includes one-time costs (allocations,
+  // first touch, tuning,...), and is excluded from the other statistics.
+  struct RunTimings {
+    int    num_calls  = 0;
+    double first_time = 0;
+    double total_time = 0;
+    double min_time   = std::numeric_limits<double>::max();
+    double max_time   = 0;
+
+    void record (const double t) {
+      if (num_calls==0) {
+        first_time = t;
+      } else {
+        total_time += t;
+        min_time = std::min(min_time,t);
+        max_time = std::max(max_time,t);
+      }
+      ++num_calls;
+    }
+  };
+  const RunTimings& get_run_timings () const { return m_run_timings; }
+
+  // Enable/disable the timing of the calls to run (disabled by default)
+  virtual void set_time_runs (const bool time_runs) { m_time_runs = time_runs; }
+
   // Computes total number of bytes needed for local variables
   virtual int requested_buffer_size_in_bytes () const { return 0; }
 
@@ -346,6 +386,10 @@ private:
   // This process's copy of the timestamp, which is set on initialization and
   // updated during stepping.
   TimeStamp t_;
+
+  // Timings of the calls to run
+  bool       m_time_runs = false;
+  RunTimings m_run_timings;
 };
 
 // A short name for the factory for atmosphere processes
@@ -130,6 +130,12 @@ void AtmosphereProcessGroup::run_sequential (const Real dt) {
   for (auto atm_proc : m_atm_processes) {
     // Run the process
     atm_proc->run(dt);
+
+    // Nested groups account their processes individually
+    if (m_conservation_check && m_conservation_check->is_check_step() &&
+        atm_proc->type()!=AtmosphereProcessType::Group) {
+      m_conservation_check->account_process(*atm_proc,dt);
+    }
   }
 }
 
@@ -235,6 +241,24 @@ process_required_field (const FieldRequest& req) {
   }
 }
 
+void AtmosphereProcessGroup::
+set_conservation_check (const std::shared_ptr<ConservationCheck>& conservation_check) {
+  m_conservation_check = conservation_check;
+  for (auto& atm_proc : m_atm_processes) {
+    if (atm_proc->type()==AtmosphereProcessType::Group) {
+      auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_proc);
+      group->set_conservation_check(conservation_check);
+    }
+  }
+}
+
+void AtmosphereProcessGroup::set_time_runs (const bool time_runs) {
+  AtmosphereProcess::set_time_runs(time_runs);
+  for (auto& atm_proc : m_atm_processes) {
+    atm_proc->set_time_runs(time_runs);
+  }
+}
+
 void AtmosphereProcessGroup::initialize_atm_memory_buffer(ATMBufferManager &memory_buffer) {
   for (auto& atm_proc : m_atm_processes) {
     memory_buffer.request_bytes(atm_proc->requested_buffer_size_in_bytes());
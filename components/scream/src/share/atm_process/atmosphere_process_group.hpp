@@ -2,6 +2,7 @@
 #define SCREAM_ATMOSPHERE_PROCESS_GROUP_HPP
 
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/atm_process/conservation_check.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
 
@@ -66,6 +67,13 @@ public:
   // Initialize memory buffer for each process
   void initialize_atm_memory_buffer (ATMBufferManager& memory_buffer);
 
+  // Set the conservation check, which computes the budget of each process (including
+  // the ones in nested groups) after it runs, at the steps where the check is active.
+  void set_conservation_check (const std::shared_ptr<ConservationCheck>& conservation_check);
+
+  // Enable/disable the timing of the calls to run, for the group and all its processes
+  void set_time_runs (const bool time_runs) override;
+
 protected:
 
   // Adds fid to the list of required/computed fields of the group (as a whole).
@@ -99,6 +107,9 @@ protected:
 
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
+
+  // The (optional) check of water and energy conservation
+  std::shared_ptr<ConservationCheck>  m_conservation_check;
 };
 
 } // namespace scream
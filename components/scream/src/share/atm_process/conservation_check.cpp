@@ -0,0 +1,288 @@
+#include "share/atm_process/conservation_check.hpp"
+
+#include "physics/share/physics_constants.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace scream
+{
+
+// The 4 sums computed by the conservation check kernel (see compute_local_sums),
+// reduced with a single parallel_reduce.
+struct ConservationSums {
+  double v[4];
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ConservationSums () : v{0,0,0,0} {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  ConservationSums& operator+= (const ConservationSums& o) {
+    for (int i=0; i<4; ++i) { v[i] += o.v[i]; }
+    return *this;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION
+  void operator+= (const volatile ConservationSums& o) volatile {
+    for (int i=0; i<4; ++i) { v[i] += o.v[i]; }
+  }
+};
+
+} // namespace scream
+
+// Specialization of a Kokkos structure, needed in the initialization of reduction operations.
+namespace Kokkos {
+template<> struct reduction_identity<scream::ConservationSums> {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static scream::ConservationSums sum() { return scream::ConservationSums(); }
+};
+} // namespace Kokkos
+
+namespace scream
+{
+
+/* ---------------------------------------------------------- */
+ConservationCheck::
+ConservationCheck (const ekat::Comm& comm,
+                   const std::shared_ptr<const field_mgr_type>& field_mgr,
+                   const ekat::ParameterList& params)
+ : m_comm      (comm)
+ , m_field_mgr (field_mgr)
+{
+  EKAT_REQUIRE_MSG (m_field_mgr!=nullptr,
+      "Error! Invalid field manager pointer for the conservation check.\n");
+
+  m_frequency  = params.get<int>("Frequency",1);
+  m_water_tol  = params.get<double>("Water Tolerance",-1);
+  m_energy_tol = params.get<double>("Energy Tolerance",-1);
+  EKAT_REQUIRE_MSG (m_frequency>0,
+      "Error! The conservation check Frequency must be positive.\n");
+
+  // The state fields are needed, while the other species and the boundary fluxes are optional
+  for (const std::string name : {"pseudo_density", "T_mid", "qv"}) {
+    EKAT_REQUIRE_MSG (m_field_mgr->has_field(name),
+        "Error! The conservation check requires field " + name + ", which is not in the field manager.\n");
+  }
+  for (const std::string name : {"pseudo_density", "T_mid", "qv", "qc", "qi", "qr",
+                                 "surf_sens_flux", "surf_latent_flux", "precip_liq_surf", "precip_ice_surf",
+                                 "SW_flux_dn", "SW_flux_up", "LW_flux_dn", "LW_flux_up"}) {
+    if (m_field_mgr->has_field(name)) {
+      m_fields.emplace(name,m_field_mgr->get_field(name));
+    }
+  }
+
+  const auto grid = m_field_mgr->get_grid();
+  m_num_cols = grid->get_num_local_dofs();
+  m_num_levs = grid->get_num_vertical_levels();
+
+  // Without the cells area, all columns have the same weight
+  m_area = decltype(m_area)("conservation check area",m_num_cols);
+  if (grid->has_geometry_data("area")) {
+    Kokkos::deep_copy(m_area,grid->get_geometry_data("area"));
+  } else {
+    Kokkos::deep_copy(m_area,1);
+  }
+  auto area_h = Kokkos::create_mirror_view(m_area);
+  Kokkos::deep_copy(area_h,m_area);
+  double local_area = 0;
+  for (int icol=0; icol<m_num_cols; ++icol) {
+    local_area += area_h(icol);
+  }
+  MPI_Allreduce(&local_area,&m_global_area,1,MPI_DOUBLE,MPI_SUM,m_comm.mpi_comm());
+}
+/* ---------------------------------------------------------- */
+void ConservationCheck::begin_step ()
+{
+  m_is_check_step = (m_num_steps % m_frequency)==0;
+  ++m_num_steps;
+
+  m_procs_names.clear();
+  m_budgets.clear();
+  m_procs_dt.clear();
+
+  if (m_is_check_step) {
+    const auto sums = compute_local_sums(BoundaryFluxes(),0);
+    m_water  = sums[0];
+    m_energy = sums[1];
+  }
+}
+/* ---------------------------------------------------------- */
+void ConservationCheck::account_process (const AtmosphereProcess& proc, const Real dt)
+{
+  EKAT_REQUIRE_MSG (m_is_check_step,
+      "Error! The conservation check can only account processes at check steps.\n");
+
+  const auto sums = compute_local_sums(get_boundary_fluxes(proc),dt);
+  m_procs_names.push_back(proc.name());
+  m_budgets.push_back({sums[0]-m_water, sums[1]-m_energy, sums[2], sums[3]});
+  m_procs_dt.push_back(dt);
+
+  // The state after this process is the initial state of the next one
+  m_water  = sums[0];
+  m_energy = sums[1];
+}
+/* ---------------------------------------------------------- */
+void ConservationCheck::end_step ()
+{
+  if (not m_is_check_step) {
+    return;
+  }
+
+  // One reduction for all the budgets of this step
+  const int num_procs = m_budgets.size();
+  std::vector<double> local(4*num_procs), global(4*num_procs);
+  for (int i=0; i<num_procs; ++i) {
+    std::copy(m_budgets[i].begin(),m_budgets[i].end(),local.begin()+4*i);
+  }
+  MPI_Allreduce(local.data(),global.data(),4*num_procs,MPI_DOUBLE,MPI_SUM,m_comm.mpi_comm());
+
+  m_imbalances.clear();
+  for (int i=0; i<num_procs; ++i) {
+    const double* b = global.data()+4*i;
+    const double dt = m_procs_dt[i];
+    Imbalance imb;
+    imb.name   = m_procs_names[i];
+    imb.water  = (b[0]-b[2]) / (m_global_area*dt);
+    imb.energy = (b[1]-b[3]) / (m_global_area*dt);
+    m_imbalances.push_back(imb);
+
+    if (m_comm.am_i_root()) {
+      // Avoid spaces in the name, so the line is easy to parse
+      auto name = imb.name;
+      std::replace(name.begin(),name.end(),' ','_');
+      const bool warn = (m_water_tol>=0 && std::abs(imb.water)>m_water_tol) ||
+                        (m_energy_tol>=0 && std::abs(imb.energy)>m_energy_tol);
+      std::printf("%sConservation: %s step=%d water=%1.6e kg/m2/s energy=%1.6e W/m2\n",
+                  warn ? "WARNING! " : "", name.c_str(), m_num_steps, imb.water, imb.energy);
+    }
+  }
+}
+/* ---------------------------------------------------------- */
+ConservationCheck::BoundaryFluxes
+ConservationCheck::get_boundary_fluxes (const AtmosphereProcess& proc) const
+{
+  // A flux enters the column during a process if the process uses the corresponding fields
+  auto uses = [&](const std::string& name) {
+    for (const auto& req : proc.get_required_fields()) {
+      if (req.fid.name()==name) { return true; }
+    }
+    for (const auto& req : proc.get_computed_fields()) {
+      if (req.fid.name()==name) { return true; }
+    }
+    return false;
+  };
+
+  BoundaryFluxes fluxes;
+  fluxes.surface    = uses("surf_sens_flux") && uses("surf_latent_flux") &&
+                      has_field("surf_sens_flux") && has_field("surf_latent_flux");
+  fluxes.precip_liq = uses("precip_liq_surf") && has_field("precip_liq_surf");
+  fluxes.precip_ice = uses("precip_ice_surf") && has_field("precip_ice_surf");
+  fluxes.radiation  = uses("SW_flux_dn") && uses("SW_flux_up") && uses("LW_flux_dn") && uses("LW_flux_up") &&
+                      has_field("SW_flux_dn") && has_field("SW_flux_up") &&
+                      has_field("LW_flux_dn") && has_field("LW_flux_up");
+  return fluxes;
+}
+/* ---------------------------------------------------------- */
+std::array<double,4>
+ConservationCheck::compute_local_sums (const BoundaryFluxes& fluxes, const Real dt) const
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using C  = physics::Constants<Real>;
+  using view_1d = field_type::view_ND_type<Real,1>;
+  using view_2d = field_type::view_ND_type<Real,2>;
+
+  const auto dp = m_fields.at("pseudo_density").get_reshaped_view<Real**>();
+  const auto T  = m_fields.at("T_mid").get_reshaped_view<Real**>();
+  const auto qv = m_fields.at("qv").get_reshaped_view<Real**>();
+
+  // Optional fields. The views are only accessed if the corresponding flag is set.
+  const bool has_qc = has_field("qc");
+  const bool has_qi = has_field("qi");
+  const bool has_qr = has_field("qr");
+  view_2d qc, qi, qr, sw_dn, sw_up, lw_dn, lw_up;
+  view_1d shf, lhf, precip_liq, precip_ice;
+  if (has_qc) { qc = m_fields.at("qc").get_reshaped_view<Real**>(); }
+  if (has_qi) { qi = m_fields.at("qi").get_reshaped_view<Real**>(); }
+  if (has_qr) { qr = m_fields.at("qr").get_reshaped_view<Real**>(); }
+  if (fluxes.surface) {
+    shf = m_fields.at("surf_sens_flux").get_reshaped_view<Real*>();
+    lhf = m_fields.at("surf_latent_flux").get_reshaped_view<Real*>();
+  }
+  if (fluxes.precip_liq) {
+    precip_liq = m_fields.at("precip_liq_surf").get_reshaped_view<Real*>();
+  }
+  if (fluxes.precip_ice) {
+    precip_ice = m_fields.at("precip_ice_surf").get_reshaped_view<Real*>();
+  }
+  if (fluxes.radiation) {
+    sw_dn = m_fields.at("SW_flux_dn").get_reshaped_view<Real**>();
+    sw_up = m_fields.at("SW_flux_up").get_reshaped_view<Real**>();
+    lw_dn = m_fields.at("LW_flux_dn").get_reshaped_view<Real**>();
+    lw_up = m_fields.at("LW_flux_up").get_reshaped_view<Real**>();
+  }
+  const bool surface    = fluxes.surface;
+  const bool has_liq_p  = fluxes.precip_liq;
+  const bool has_ice_p  = fluxes.precip_ice;
+  const bool radiation  = fluxes.radiation;
+
+  const auto area  = m_area;
+  const int nlevs  = m_num_levs;
+  const Real g     = C::gravit;
+  const Real cp    = C::Cpair;
+  const Real Lv    = C::LatVap;
+  const Real Lf    = C::LatIce;
+  const Real rho_w = C::RHO_H2O;
+
+  // Area-weighted column integrals, and water/energy entering the columns, summed over
+  // the local columns with one fused kernel (W and E are reduced together over the levels).
+  ConservationSums sums;
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols,nlevs);
+  Kokkos::parallel_reduce("ConservationCheck::compute_local_sums", policy,
+                          KOKKOS_LAMBDA (const KT::MemberType& team, ConservationSums& update) {
+    const int icol = team.league_rank();
+
+    ConservationSums col;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,nlevs), [&] (const int k, ConservationSums& sum) {
+      const Real q_liq = (has_qc ? qc(icol,k) : 0) + (has_qr ? qr(icol,k) : 0);
+      const Real q_ice = has_qi ? qi(icol,k) : 0;
+      sum.v[0] += (qv(icol,k) + q_liq + q_ice)*dp(icol,k)/g;
+      sum.v[1] += (cp*T(icol,k) + (Lv+Lf)*qv(icol,k) + Lf*q_liq)*dp(icol,k)/g;
+    }, col);
+
+    Kokkos::single(Kokkos::PerTeam(team),[&] {
+      // Surface evaporation (a water mass flux, see above) carries the latent heat of vaporization and fusion
+      // (ice is the reference state), while liquid precipitation takes away the latent heat of fusion,
+      // and ice precipitation no latent heat at all.
+      double water_in  = 0;
+      double energy_in = 0;
+      if (surface) {
+        water_in  += lhf(icol)*dt;
+        energy_in += (shf(icol) + (Lv+Lf)*lhf(icol))*dt;
+      }
+      if (has_liq_p) {
+        water_in  -= rho_w*precip_liq(icol)*dt;
+        energy_in -= Lf*rho_w*precip_liq(icol)*dt;
+      }
+      if (has_ice_p) {
+        water_in  -= rho_w*precip_ice(icol)*dt;
+      }
+      if (radiation) {
+        const Real net_top = sw_dn(icol,0) - sw_up(icol,0) + lw_dn(icol,0) - lw_up(icol,0);
+        const Real net_bot = sw_dn(icol,nlevs) - sw_up(icol,nlevs) + lw_dn(icol,nlevs) - lw_up(icol,nlevs);
+        energy_in += (net_top-net_bot)*dt;
+      }
+      update.v[0] += area(icol)*col.v[0];
+      update.v[1] += area(icol)*col.v[1];
+      update.v[2] += area(icol)*water_in;
+      update.v[3] += area(icol)*energy_in;
+    });
+  }, sums);
+
+  return {sums.v[0], sums.v[1], sums.v[2], sums.v[3]};
+}
+/* ---------------------------------------------------------- */
+
+} // namespace scream
@@ -0,0 +1,145 @@
+#ifndef SCREAM_CONSERVATION_CHECK_HPP
+#define SCREAM_CONSERVATION_CHECK_HPP
+
+#include "share/atm_process/atmosphere_process.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ *  A check of the conservation of total water and total energy across the
+ *  atmosphere processes.
+ *
+ *  At the steps where the check is active, the column integrals of
+ *
+ *    total water:  W = sum_k (qv+qc+qi+qr)*dp/g
+ *    total energy: E = sum_k (cp*T + (Lv+Lf)*qv + Lf*(qc+qr))*dp/g
+ *
+ *  are computed before the first process, and after each process. The change
+ *  across a process, minus the water/energy that entered the column through its
+ *  boundaries during the process, is the imbalance of that process. The energy
+ *  uses ice as reference state, so that phase changes conserve E exactly.
+ *  Species missing from the field manager are assumed to be zero.
+ *
+ *  The boundary fluxes accounted for are
+ *    - surface fluxes (surf_sens_flux, surf_latent_flux),
+ *    - surface precipitation (precip_liq_surf, precip_ice_surf),
+ *    - net radiative fluxes at the model top and at the surface (SW/LW_flux_dn/up),
+ *  and each is attributed to the processes that require or compute the corresponding
+ *  fields (e.g., surface fluxes to the turbulence scheme, precipitation to microphysics).
+ *  Note: surf_latent_flux is used as SHOC uses it, i.e. as the surface water vapor flux
+ *        (in kg/m2/s, despite the W/m2 units it is registered with). Precipitation rates
+ *        are in m/s of liquid water. Precipitating ice carries no latent heat w.r.t. the
+ *        ice reference state, so it only removes water.
+ *
+ *  All the column integrals of a step are computed with one fused kernel per process,
+ *  and the budgets of all processes are reduced over MPI ranks with a single reduction,
+ *  at the end of the step. The imbalances are area-weighted global means, in kg/m2/s for
+ *  water, and W/m2 for energy.
+ *
+ *  The check is configured via the following parameters (all optional):
+ *    Frequency: INT            check every this many steps (default: 1)
+ *    Water Tolerance: REAL     warn if the abs value of a water imbalance exceeds this (default: none)
+ *    Energy Tolerance: REAL    warn if the abs value of an energy imbalance exceeds this (default: none)
+ *
+ *  Note: the check is driven by the AtmosphereDriver (begin_step/end_step) and by the
+ *        AtmosphereProcessGroup (account_process), and only makes sense for sequential
+ *        groups. Processes in nested groups are accounted individually.
+ */
+
+class ConservationCheck
+{
+public:
+  using field_mgr_type = FieldManager<Real>;
+  using field_type     = Field<Real>;
+
+  ConservationCheck (const ekat::Comm& comm,
+                     const std::shared_ptr<const field_mgr_type>& field_mgr,
+                     const ekat::ParameterList& params);
+
+  // Start a new atm step. At check steps, compute the column integrals of the initial state.
+  void begin_step ();
+
+  // Whether the budgets are computed in the current step
+  bool is_check_step () const { return m_is_check_step; }
+
+  // Compute the budget of a process that just ran with time step dt.
+  void account_process (const AtmosphereProcess& proc, const Real dt);
+
+  // Reduce the budgets of this step over all ranks, and report them (on the root rank).
+  void end_step ();
+
+  // The global-mean imbalances of each process at the last check step
+  struct Imbalance {
+    std::string name;
+    double water;   // [kg/m2/s]
+    double energy;  // [W/m2]
+  };
+  const std::vector<Imbalance>& get_imbalances () const { return m_imbalances; }
+
+  // Which boundary fluxes enter the column during a process
+  struct BoundaryFluxes {
+    bool surface    = false;
+    bool precip_liq = false;
+    bool precip_ice = false;
+    bool radiation  = false;
+  };
+
+  // Compute the area-weighted sums (over local columns) of the column integrals of W and E,
+  // and of the water and energy that entered the columns in a time step dt, with the given fluxes.
+  // Note: public, since CUDA does not allow device lambdas inside private/protected methods.
+  std::array<double,4> compute_local_sums (const BoundaryFluxes& fluxes, const Real dt) const;
+
+protected:
+
+  BoundaryFluxes get_boundary_fluxes (const AtmosphereProcess& proc) const;
+
+  bool has_field (const std::string& name) const { return m_fields.find(name)!=m_fields.end(); }
+
+  ekat::Comm                                  m_comm;
+  std::shared_ptr<const field_mgr_type>       m_field_mgr;
+
+  // The fields needed for the budgets that are available in the field manager
+  std::map<std::string,field_type>            m_fields;
+
+  // The area of the columns (all ones if the grid does not store it), and the total area over all ranks
+  KokkosTypes<DefaultDevice>::view_1d<Real>   m_area;
+  double                                      m_global_area;
+
+  int     m_num_cols;
+  int     m_num_levs;
+
+  int     m_frequency;
+  int     m_num_steps = 0;
+  bool    m_is_check_step = false;
+  double  m_water_tol;
+  double  m_energy_tol;
+
+  // Local sums of W and E of the current state
+  double  m_water;
+  double  m_energy;
+
+  // Local budgets of the processes in the current step: change of W and E, and W and E
+  // that entered through the boundaries.
+  std::vector<std::string>            m_procs_names;
+  std::vector<std::array<double,4>>   m_budgets;
+  std::vector<double>                 m_procs_dt;
+
+  std::vector<Imbalance>              m_imbalances;
+};
+
+} // namespace scream
+
+#endif // SCREAM_CONSERVATION_CHECK_HPP
@@ -39,7 +39,10 @@ enum class FieldTag {
   // Added for RRTMGP, TODO: Revisit this approach, is there a better way than adding more field tags?
   Gases,
   ShortWaveBand,
-  LongWaveBand
+  LongWaveBand,
+  // Target levels of a vertical remap of output fields (see output_vertical_remap.hpp)
+  PressureLevel,
+  HeightLevel
 };
 
 inline std::string e2str (const FieldTag ft) {
@@ -88,6 +91,12 @@ inline std::string e2str (const FieldTag ft) {
     case FieldTag::LongWaveBand:
       name = "LWBND";
       break;
+    case FieldTag::PressureLevel:
+      name = "PLEV";
+      break;
+    case FieldTag::HeightLevel:
+      name = "ZLEV";
+      break;
     default:
       EKAT_ERROR_MSG("Error! Unrecognized field tag.");
   }
@@ -115,6 +124,8 @@ namespace ShortFieldTagsNames {
   constexpr auto NGAS = FieldTag::Gases;
   constexpr auto SWBND = FieldTag::ShortWaveBand;
   constexpr auto LWBND = FieldTag::LongWaveBand;
+  constexpr auto PLEV  = FieldTag::PressureLevel;
+  constexpr auto ZLEV  = FieldTag::HeightLevel;
 }
 
 } // namespace scream
@@ -92,6 +92,11 @@ public:
   // Get a 1d view containing the dof gids
   const dofs_list_type& get_dofs_gids () const { return m_dofs_gids; }
 
+  // Ensemble runs stack the columns of all members in one grid, so that each atm process
+  // runs once over the columns of all members. The dofs of member m are the global dofs
+  // [m*N,(m+1)*N), with N=num_global_dofs/num_ensemble_members.
+  int get_num_ensemble_members () const { return m_num_ensemble_members; }
+
   // Get a 2d view, where (i,j) entry contains the j-th coordinate of
   // the i-th dof in the native dof layout.
   const lid_to_idx_map_type& get_lid_to_idx_map () const { return m_lid_to_idx; }
@@ -99,6 +104,7 @@ public:
   // Set/get geometric views. The setter is virtual, so each grid can check if "name" is supported.
   virtual void set_geometry_data (const std::string& name, const geo_view_type& data) = 0;
   const geo_view_type& get_geometry_data (const std::string& name) const;
+  bool has_geometry_data (const std::string& name) const { return m_geo_views.find(name)!=m_geo_views.end(); }
 
 protected:
 
@@ -110,6 +116,7 @@ protected:
   int m_num_local_dofs;
   int m_num_global_dofs;
   int m_num_vert_levs;
+  int m_num_ensemble_members = 1;
 
   // The global ID of each dof
   dofs_list_type        m_dofs_gids;
@@ -89,12 +89,23 @@ set_geometry_data (const std::string& name, const geo_view_type& data) {
   // Sanity checks
   EKAT_REQUIRE_MSG (data.extent_int(0)==m_num_local_dofs,
                     "Error! Input geometry data has wrong dimensions.\n");
-  EKAT_REQUIRE_MSG (name=="lat" || name=="lon" || name=="area",
+  EKAT_REQUIRE_MSG (name=="lat" || name=="lon" || name=="area" || name=="ensemble_member",
                     "Error! Point grid does not support geometry data '" + name + "'.\n");
 
   m_geo_views[name] = data;
 }
 
+void PointGrid::
+set_num_ensemble_members (const int num_members)
+{
+  EKAT_REQUIRE_MSG (num_members>=1,
+                    "Error! The number of ensemble members is not positive.\n");
+  EKAT_REQUIRE_MSG (m_num_global_dofs % num_members == 0,
+                    "Error! The number of global columns is not a multiple of the number of ensemble members.\n");
+
+  m_num_ensemble_members = num_members;
+}
+
 std::shared_ptr<const PointGrid>
 create_point_grid (const std::string& grid_name,
                    const int num_global_cols,
@@ -156,4 +167,36 @@ create_point_grid (const std::string& grid_name,
   return grid;
 }
 
+std::shared_ptr<const PointGrid>
+create_point_grid (const std::string& grid_name,
+                   const int num_member_cols,
+                   const int num_vertical_lev,
+                   const int num_members,
+                   const ekat::Comm& comm)
+{
+  EKAT_REQUIRE_MSG (num_members>=1,
+                    "Error! The number of ensemble members is not positive.\n");
+
+  // The stacked grid is a regular point grid, so that physics runs over the columns of all members at once.
+  auto grid = std::const_pointer_cast<PointGrid>(
+      create_point_grid(grid_name,num_member_cols*num_members,num_vertical_lev,comm));
+  grid->set_num_ensemble_members(num_members);
+
+  if (num_members>1) {
+    // Store the member of each column, which atm processes can use to look up per-member parameters.
+    const int num_my_cols = grid->get_num_local_dofs();
+    AbstractGrid::geo_view_type member ("ensemble_member", num_my_cols);
+    auto h_member = Kokkos::create_mirror_view(member);
+    auto h_dofs_gids = Kokkos::create_mirror_view(grid->get_dofs_gids());
+    Kokkos::deep_copy(h_dofs_gids,grid->get_dofs_gids());
+    for (int i=0; i<num_my_cols; ++i) {
+      h_member(i) = h_dofs_gids(i) / num_member_cols;
+    }
+    Kokkos::deep_copy(member,h_member);
+    grid->set_geometry_data("ensemble_member",member);
+  }
+
+  return grid;
+}
+
 } // namespace scream
@@ -42,6 +42,8 @@ public:
 
   void set_dofs (const dofs_list_type& dofs);
   void set_geometry_data (const std::string& name, const geo_view_type& data) override;
+
+  void set_num_ensemble_members (const int num_members);
 };
 
 // Create a point grid, with linear range of gids, evenly partitioned
@@ -52,6 +54,16 @@ create_point_grid (const std::string& name,
                    const int num_vertical_lev,
                    const ekat::Comm& comm);
 
+// Create a point grid for an ensemble run, stacking the columns of num_members members,
+// with num_member_cols columns each. The gid of column i of member m is m*num_member_cols+i,
+// and the geometry data 'ensemble_member' stores the member of each local column.
+std::shared_ptr<const PointGrid>
+create_point_grid (const std::string& name,
+                   const int num_member_cols,
+                   const int num_vertical_lev,
+                   const int num_members,
+                   const ekat::Comm& comm);
+
 } // namespace scream
 
 #endif // SCREAM_POINT_GRID_HPP
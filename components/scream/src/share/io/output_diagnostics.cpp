@@ -0,0 +1,242 @@
+#include "share/io/output_diagnostics.hpp"
+
+#include "share/util/scream_common_physics_functions.hpp"
+#include "physics/share/physics_constants.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+namespace scream
+{
+
+/* ---------------------------------------------------------- */
+OutputDiagnostic::
+OutputDiagnostic (const std::shared_ptr<const field_mgr_type>& field_mgr,
+                  const std::string& name)
+ : m_field_mgr (field_mgr)
+ , m_name      (name)
+{
+  EKAT_REQUIRE_MSG (m_field_mgr!=nullptr,
+      "Error! Invalid field manager pointer for output diagnostic " + m_name + ".\n");
+
+  m_num_cols = m_field_mgr->get_grid()->get_num_local_dofs();
+  m_num_levs = m_field_mgr->get_grid()->get_num_vertical_levels();
+}
+/* ---------------------------------------------------------- */
+void OutputDiagnostic::init ()
+{
+  for (const auto& fname : get_input_fields()) {
+    EKAT_REQUIRE_MSG (m_field_mgr->has_field(fname),
+        "Error! Output diagnostic " + m_name + " requires field " + fname + ",\n"
+        "       which is not in the field manager.\n");
+    m_inputs.emplace(fname,m_field_mgr->get_field(fname));
+  }
+
+  FieldIdentifier fid (m_name,get_layout(),get_units(),m_field_mgr->get_grid()->name());
+  m_diagnostic = field_type(fid);
+  m_diagnostic.allocate_view();
+}
+/* ---------------------------------------------------------- */
+void OutputDiagnostic::compute ()
+{
+  // Only recompute if some input changed since the last call.
+  // The diagnostic is only as recent as the oldest of its inputs.
+  bool inputs_changed = false;
+  util::TimeStamp oldest;
+  for (const auto& it : m_inputs) {
+    const auto& ts = it.second.get_header().get_tracking().get_time_stamp();
+    EKAT_REQUIRE_MSG (ts.is_valid(),
+        "Error! Field " + it.first + ", needed by output diagnostic " + m_name + ", has not been initialized yet.\n");
+    auto last = m_inputs_time_stamps.find(it.first);
+    if (last==m_inputs_time_stamps.end() || !(last->second==ts)) {
+      inputs_changed = true;
+      m_inputs_time_stamps[it.first] = ts;
+    }
+    if (!oldest.is_valid() || ts<oldest) {
+      oldest = ts;
+    }
+  }
+
+  if (inputs_changed || !m_diagnostic.get_header().get_tracking().get_time_stamp().is_valid()) {
+    compute_impl();
+    Kokkos::fence();
+    m_diagnostic.get_header().get_tracking().update_time_stamp(oldest);
+  }
+}
+/* ---------------------------------------------------------- */
+
+// Note: compute_impl is public in the classes below, since CUDA does not allow
+//       device lambdas inside private/protected methods.
+
+using KT = KokkosTypes<DefaultDevice>;
+using PF = PhysicsFunctions<DefaultDevice>;
+
+// Diagnostics defined pointwise on level midpoints, from fields on level midpoints
+class PotentialTemperatureDiagnostic : public OutputDiagnostic
+{
+public:
+  using OutputDiagnostic::OutputDiagnostic;
+
+protected:
+  std::vector<std::string> get_input_fields () const override { return {"T_mid", "p_mid"}; }
+
+  FieldLayout get_layout () const override {
+    using namespace ShortFieldTagsNames;
+    return FieldLayout({COL,LEV},{m_num_cols,m_num_levs});
+  }
+
+  ekat::units::Units get_units () const override { return ekat::units::K; }
+
+public:
+  void compute_impl () override {
+    const auto T     = m_inputs.at("T_mid").get_reshaped_view<Real**>();
+    const auto p     = m_inputs.at("p_mid").get_reshaped_view<Real**>();
+    const auto theta = m_diagnostic.get_reshaped_view<Real**>();
+    const int nlevs  = m_num_levs;
+    Kokkos::parallel_for(m_name, Kokkos::RangePolicy<KT::ExeSpace>(0,m_num_cols*nlevs),
+                         KOKKOS_LAMBDA (const int idx) {
+      const int icol = idx / nlevs;
+      const int ilev = idx % nlevs;
+      theta(icol,ilev) = PF::calculate_theta_from_T(T(icol,ilev),p(icol,ilev));
+    });
+  }
+};
+
+class VirtualTemperatureDiagnostic : public OutputDiagnostic
+{
+public:
+  using OutputDiagnostic::OutputDiagnostic;
+
+protected:
+  std::vector<std::string> get_input_fields () const override { return {"T_mid", "qv"}; }
+
+  FieldLayout get_layout () const override {
+    using namespace ShortFieldTagsNames;
+    return FieldLayout({COL,LEV},{m_num_cols,m_num_levs});
+  }
+
+  ekat::units::Units get_units () const override { return ekat::units::K; }
+
+public:
+  void compute_impl () override {
+    const auto T     = m_inputs.at("T_mid").get_reshaped_view<Real**>();
+    const auto qv    = m_inputs.at("qv").get_reshaped_view<Real**>();
+    const auto T_vir = m_diagnostic.get_reshaped_view<Real**>();
+    const int nlevs  = m_num_levs;
+    Kokkos::parallel_for(m_name, Kokkos::RangePolicy<KT::ExeSpace>(0,m_num_cols*nlevs),
+                         KOKKOS_LAMBDA (const int idx) {
+      const int icol = idx / nlevs;
+      const int ilev = idx % nlevs;
+      T_vir(icol,ilev) = PF::calculate_virtual_temperature(T(icol,ilev),qv(icol,ilev));
+    });
+  }
+};
+
+// Vertical integral of a water species: sum_k q(k)*dp(k)/g
+class WaterPathDiagnostic : public OutputDiagnostic
+{
+public:
+  WaterPathDiagnostic (const std::shared_ptr<const field_mgr_type>& field_mgr,
+                       const std::string& name)
+   : OutputDiagnostic(field_mgr,name)
+  {
+    const ekat::CaseInsensitiveString ci_name (name);
+    if (ci_name=="VapWaterPath") {
+      m_species = "qv";
+    } else if (ci_name=="LiqWaterPath") {
+      m_species = "qc";
+    } else if (ci_name=="IceWaterPath") {
+      m_species = "qi";
+    } else if (ci_name=="RainWaterPath") {
+      m_species = "qr";
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported water path diagnostic " + name + ".\n");
+    }
+  }
+
+protected:
+  std::vector<std::string> get_input_fields () const override { return {m_species, "pseudo_density"}; }
+
+  FieldLayout get_layout () const override {
+    using namespace ShortFieldTagsNames;
+    return FieldLayout({COL},{m_num_cols});
+  }
+
+  ekat::units::Units get_units () const override {
+    using namespace ekat::units;
+    return kg/(m*m);
+  }
+
+public:
+  void compute_impl () override {
+    const auto q     = m_inputs.at(m_species).get_reshaped_view<Real**>();
+    const auto dp    = m_inputs.at("pseudo_density").get_reshaped_view<Real**>();
+    const auto path  = m_diagnostic.get_view();
+    const int nlevs  = m_num_levs;
+    const Real g     = physics::Constants<Real>::gravit;
+    const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols,nlevs);
+    Kokkos::parallel_for(m_name, policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+      const int icol = team.league_rank();
+      Real column_sum = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,nlevs),
+                              [&] (const int ilev, Real& sum) {
+        sum += q(icol,ilev)*dp(icol,ilev);
+      }, column_sum);
+      Kokkos::single(Kokkos::PerTeam(team),[&] {
+        path(icol) = column_sum/g;
+      });
+    });
+  }
+
+protected:
+  std::string m_species;
+};
+
+/* ---------------------------------------------------------- */
+std::set<ekat::CaseInsensitiveString>& output_diagnostics_names ()
+{
+  static std::set<ekat::CaseInsensitiveString> names;
+  return names;
+}
+/* ---------------------------------------------------------- */
+void register_output_diagnostics ()
+{
+  register_output_diagnostic<PotentialTemperatureDiagnostic>("PotentialTemperature");
+  register_output_diagnostic<VirtualTemperatureDiagnostic>("VirtualTemperature");
+  register_output_diagnostic<WaterPathDiagnostic>("VapWaterPath");
+  register_output_diagnostic<WaterPathDiagnostic>("LiqWaterPath");
+  register_output_diagnostic<WaterPathDiagnostic>("IceWaterPath");
+  register_output_diagnostic<WaterPathDiagnostic>("RainWaterPath");
+}
+/* ---------------------------------------------------------- */
+OutputDiagnostics::
+OutputDiagnostics (const std::shared_ptr<const field_mgr_type>& field_mgr)
+ : m_field_mgr (field_mgr)
+{
+  register_output_diagnostics();
+}
+/* ---------------------------------------------------------- */
+bool OutputDiagnostics::is_diagnostic (const std::string& name) const
+{
+  return output_diagnostics_names().count(name)==1;
+}
+/* ---------------------------------------------------------- */
+std::shared_ptr<OutputDiagnostic>
+OutputDiagnostics::get_diagnostic (const std::string& name)
+{
+  EKAT_REQUIRE_MSG (is_diagnostic(name),
+      "Error! " + name + " is neither a field in the field manager nor a registered output diagnostic.\n");
+
+  auto it = m_diagnostics.find(name);
+  if (it!=m_diagnostics.end()) {
+    return it->second;
+  }
+
+  std::shared_ptr<OutputDiagnostic> diag = OutputDiagnosticFactory::instance().create(name,m_field_mgr,name);
+  diag->init();
+  m_diagnostics.emplace(name,diag);
+  return diag;
+}
+/* ---------------------------------------------------------- */
+
+} // namespace scream
@@ -0,0 +1,138 @@
+#ifndef SCREAM_OUTPUT_DIAGNOSTICS_HPP
+#define SCREAM_OUTPUT_DIAGNOSTICS_HPP
+
+#include "share/field/field_manager.hpp"
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_factory.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * An OutputDiagnostic is a field that is not stored in the FieldManager, but
+ * can be computed from fields in the FieldManager, and written by output streams.
+ *
+ * Output streams request diagnostics by name, in the FIELDS list of their yaml
+ * file (see scorpio_output.hpp): any name that is not a field in the FieldManager
+ * is looked up in the OutputDiagnosticFactory. This way, diagnostics are only
+ * computed if some stream asks for them, and only at the steps where the stream
+ * samples them (every step for averaged streams, only at write steps for
+ * instantaneous ones).
+ *
+ * The diagnostic field has the time stamp of the oldest of the input fields.
+ * If compute is called again with no input field updated in the meantime (e.g.,
+ * by two streams at the same step), the stored values are reused.
+ *
+ * To add a diagnostic, derive from this class, implement the three pure
+ * virtual methods, and register a creator in register_output_diagnostics.
+ */
+
+class OutputDiagnostic
+{
+public:
+  using field_mgr_type = FieldManager<Real>;
+  using field_type     = Field<Real>;
+
+  OutputDiagnostic (const std::shared_ptr<const field_mgr_type>& field_mgr,
+                    const std::string& name);
+  virtual ~OutputDiagnostic () = default;
+
+  const std::string& name () const { return m_name; }
+
+  // The field storing the diagnostic. Only valid after init.
+  const field_type& get_diagnostic () const { return m_diagnostic; }
+
+  // Check that the input fields are available, and allocate the diagnostic field.
+  void init ();
+
+  // Compute the diagnostic from the current value of the inputs (if needed).
+  void compute ();
+
+protected:
+
+  // The names of the fields needed to compute the diagnostic
+  virtual std::vector<std::string> get_input_fields () const = 0;
+
+  // The layout and units of the diagnostic field
+  virtual FieldLayout get_layout () const = 0;
+  virtual ekat::units::Units get_units () const = 0;
+
+  // Fill m_diagnostic, given the input fields
+  virtual void compute_impl () = 0;
+
+  std::shared_ptr<const field_mgr_type>   m_field_mgr;
+  std::string                             m_name;
+  field_type                              m_diagnostic;
+  std::map<std::string,field_type>        m_inputs;
+  // Time stamps of the inputs at the last call to compute
+  std::map<std::string,util::TimeStamp>   m_inputs_time_stamps;
+
+  // Number of columns and levels of the grid of the field manager
+  int m_num_cols;
+  int m_num_levs;
+};
+
+// A short name for the factory of output diagnostics
+using OutputDiagnosticFactory =
+    ekat::Factory<OutputDiagnostic,
+                  ekat::CaseInsensitiveString,
+                  std::shared_ptr<OutputDiagnostic>,
+                  const std::shared_ptr<const FieldManager<Real>>&,
+                  const std::string&>;
+
+template <typename DiagType>
+inline std::shared_ptr<OutputDiagnostic>
+create_output_diagnostic (const std::shared_ptr<const FieldManager<Real>>& field_mgr,
+                          const std::string& name) {
+  return std::make_shared<DiagType>(field_mgr,name);
+}
+
+// The names of the diagnostics registered in the OutputDiagnosticFactory
+std::set<ekat::CaseInsensitiveString>& output_diagnostics_names ();
+
+// Register a diagnostic in the OutputDiagnosticFactory (if not already registered)
+template <typename DiagType>
+inline void register_output_diagnostic (const std::string& name) {
+  if (output_diagnostics_names().insert(name).second) {
+    OutputDiagnosticFactory::instance().register_product(name,&create_output_diagnostic<DiagType>);
+  }
+}
+
+// Register the diagnostics available in SCREAM in the OutputDiagnosticFactory.
+// Can be called multiple times.
+void register_output_diagnostics ();
+
+/*
+ * The diagnostics used by a set of output streams, so that streams writing
+ * the same diagnostic share it (and compute it only once per step).
+ */
+class OutputDiagnostics
+{
+public:
+  using field_mgr_type = OutputDiagnostic::field_mgr_type;
+
+  explicit OutputDiagnostics (const std::shared_ptr<const field_mgr_type>& field_mgr);
+
+  // Whether a diagnostic with this name can be created
+  bool is_diagnostic (const std::string& name) const;
+
+  // Get a diagnostic, creating (and initializing) it the first time it is requested
+  std::shared_ptr<OutputDiagnostic> get_diagnostic (const std::string& name);
+
+protected:
+  std::shared_ptr<const field_mgr_type>                       m_field_mgr;
+  std::map<std::string,std::shared_ptr<OutputDiagnostic>>     m_diagnostics;
+};
+
+} // namespace scream
+
+#endif // SCREAM_OUTPUT_DIAGNOSTICS_HPP
@@ -112,6 +112,8 @@ protected:
   ekat::ParameterList                          m_params;
   std::shared_ptr<const FieldManager<Real>> m_device_field_manager;
   std::shared_ptr<const GridsManager>          m_grids_manager;
+  // Diagnostics shared by all output streams, see output_diagnostics.hpp
+  std::shared_ptr<OutputDiagnostics>           m_diagnostics;
 
   bool                                 param_set = false;
   bool                                 gm_set    = false;
@@ -127,6 +129,10 @@ protected:
 inline void OutputManager::new_output(const ekat::ParameterList& params)
 {
   auto output_instance = std::make_shared<output_type>(pio_comm,params,m_device_field_manager,m_grids_manager,m_runtype_restart);
+  if (m_diagnostics==nullptr) {
+    m_diagnostics = std::make_shared<OutputDiagnostics>(m_device_field_manager);
+  }
+  output_instance->set_diagnostics(m_diagnostics);
   output_instance->init();
   m_output_streams.push_back(output_instance);
 }
@@ -134,6 +140,10 @@ inline void OutputManager::new_output(const ekat::ParameterList& params)
 inline void OutputManager::new_output(const ekat::ParameterList& params, const bool runtype_restart)
 {
   auto output_instance = std::make_shared<output_type>(pio_comm,params,m_device_field_manager,m_grids_manager,runtype_restart);
+  if (m_diagnostics==nullptr) {
+    m_diagnostics = std::make_shared<OutputDiagnostics>(m_device_field_manager);
+  }
+  output_instance->set_diagnostics(m_diagnostics);
   output_instance->init();
   m_output_streams.push_back(output_instance);
 }
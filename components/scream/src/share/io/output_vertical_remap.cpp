@@ -0,0 +1,149 @@
+#include "share/io/output_vertical_remap.hpp"
+
+#include "share/util/scream_column_ops.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <cmath>
+
+namespace scream
+{
+
+/* ---------------------------------------------------------- */
+OutputVerticalRemap::
+OutputVerticalRemap (const std::shared_ptr<const field_mgr_type>& field_mgr,
+                     const ekat::ParameterList& params)
+ : m_field_mgr (field_mgr)
+{
+  EKAT_REQUIRE_MSG (m_field_mgr!=nullptr,
+      "Error! Invalid field manager pointer for output vertical remap.\n");
+
+  const ekat::CaseInsensitiveString coord = params.get<std::string>("COORDINATE");
+  if (coord=="Pressure") {
+    m_coordinate = Coordinate::Pressure;
+  } else if (coord=="Height") {
+    m_coordinate = Coordinate::Height;
+  } else {
+    EKAT_ERROR_MSG ("Error! Unsupported vertical remap COORDINATE '" + params.get<std::string>("COORDINATE") + "'.\n"
+                    "       Valid options are: Pressure, Height.\n");
+  }
+
+  // The yaml parser stores a list of integers (e.g., [85000, 50000]) as ints.
+  if (params.isType<std::vector<int>>("LEVELS")) {
+    for (auto lev : params.get<std::vector<int>>("LEVELS")) {
+      m_levels.push_back(lev);
+    }
+  } else {
+    for (auto lev : params.get<std::vector<double>>("LEVELS")) {
+      m_levels.push_back(lev);
+    }
+  }
+  EKAT_REQUIRE_MSG (m_levels.size()>0,
+      "Error! Vertical remap LEVELS must contain at least one level.\n");
+
+  const int num_levels = m_levels.size();
+  m_levels_coord = decltype(m_levels_coord)("vertical remap levels",num_levels);
+  auto levels_coord_h = Kokkos::create_mirror_view(m_levels_coord);
+  for (int k=0; k<num_levels; ++k) {
+    if (m_coordinate==Coordinate::Pressure) {
+      EKAT_REQUIRE_MSG (m_levels[k]>0,
+          "Error! Vertical remap pressure levels must be positive.\n");
+      levels_coord_h(k) = std::log(m_levels[k]);
+    } else {
+      levels_coord_h(k) = m_levels[k];
+    }
+  }
+  Kokkos::deep_copy(m_levels_coord,levels_coord_h);
+}
+/* ---------------------------------------------------------- */
+std::string OutputVerticalRemap::coordinate_name () const
+{
+  return m_coordinate==Coordinate::Pressure ? "plev" : "zlev";
+}
+/* ---------------------------------------------------------- */
+std::string OutputVerticalRemap::get_coordinate_field_name (const bool interfaces) const
+{
+  if (m_coordinate==Coordinate::Pressure) {
+    return interfaces ? "p_int" : "p_mid";
+  }
+  return interfaces ? "z_int" : "z_mid";
+}
+/* ---------------------------------------------------------- */
+bool OutputVerticalRemap::can_remap (const field_type& src) const
+{
+  using namespace ShortFieldTagsNames;
+
+  const auto& layout = src.get_header().get_identifier().get_layout();
+  return layout.rank()==2 && layout.tag(0)==COL && (layout.tag(1)==LEV || layout.tag(1)==ILEV);
+}
+/* ---------------------------------------------------------- */
+OutputVerticalRemap::field_type
+OutputVerticalRemap::create_target_field (const field_type& src) const
+{
+  using namespace ShortFieldTagsNames;
+
+  const auto& src_fid = src.get_header().get_identifier();
+  EKAT_REQUIRE_MSG (can_remap(src),
+      "Error! Field " + src_fid.name() + " cannot be vertically remapped.\n"
+      "       Only fields with layout (COL,LEV) or (COL,ILEV) are supported.\n");
+
+  const auto& src_layout = src_fid.get_layout();
+  const auto coord_name = get_coordinate_field_name(src_layout.tag(1)==ILEV);
+  EKAT_REQUIRE_MSG (m_field_mgr->has_field(coord_name),
+      "Error! Vertical remap of field " + src_fid.name() + " requires field " + coord_name + ",\n"
+      "       which is not in the field manager.\n");
+
+  const auto tgt_tag = m_coordinate==Coordinate::Pressure ? PLEV : ZLEV;
+  FieldLayout tgt_layout ({COL,tgt_tag},{src_layout.dim(0),static_cast<int>(m_levels.size())});
+  FieldIdentifier tgt_fid (src_fid.name(),tgt_layout,src_fid.get_units(),src_fid.get_grid_name());
+  field_type tgt (tgt_fid);
+  tgt.allocate_view();
+  return tgt;
+}
+/* ---------------------------------------------------------- */
+void OutputVerticalRemap::remap (const field_type& src, field_type& tgt) const
+{
+  using namespace ShortFieldTagsNames;
+  using KT = KokkosTypes<DefaultDevice>;
+  using col_ops = ColumnOps<DefaultDevice,Real>;
+
+  const auto& src_layout = src.get_header().get_identifier().get_layout();
+  const bool interfaces  = src_layout.tag(1)==ILEV;
+  const auto coord = m_field_mgr->get_field(get_coordinate_field_name(interfaces));
+
+  const auto& ts = src.get_header().get_tracking().get_time_stamp();
+  EKAT_REQUIRE_MSG (coord.get_header().get_tracking().get_time_stamp().is_valid(),
+      "Error! Field " + coord.get_header().get_identifier().name() + ", needed for the vertical remap of "
+      + src.get_header().get_identifier().name() + ", has not been initialized yet.\n");
+
+  const auto x_src  = coord.get_reshaped_view<Real**>();
+  const auto y_src  = src.get_reshaped_view<Real**>();
+  const auto y_tgt  = tgt.get_reshaped_view<Real**>();
+  const auto x_tgt  = m_levels_coord;
+  const int ncols   = src_layout.dim(0);
+  const int nsrc    = src_layout.dim(1);
+  const int ntgt    = m_levels.size();
+  const bool log_p  = m_coordinate==Coordinate::Pressure;
+
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncols,ntgt);
+  Kokkos::parallel_for("OutputVerticalRemap::remap", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+    const int icol = team.league_rank();
+    auto x = [&](const int k)->Real {
+      return log_p ? log(x_src(icol,k)) : x_src(icol,k);
+    };
+    auto y = [&](const int k)->Real {
+      return y_src(icol,k);
+    };
+    auto y_col = ekat::subview(y_tgt,icol);
+    col_ops::compute_interpolated_values(team,nsrc,x,y,ntgt,x_tgt,y_col);
+  });
+  Kokkos::fence();
+
+  tgt.get_header().get_tracking().update_time_stamp(ts);
+}
+/* ---------------------------------------------------------- */
+
+} // namespace scream
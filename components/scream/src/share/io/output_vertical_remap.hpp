@@ -0,0 +1,87 @@
+#ifndef SCREAM_OUTPUT_VERTICAL_REMAP_HPP
+#define SCREAM_OUTPUT_VERTICAL_REMAP_HPP
+
+#include "share/field/field_manager.hpp"
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * The vertical remap of the fields of an output stream to a set of pressure
+ * or height levels (e.g., 850, 500, 200 hPa), so that only the requested
+ * levels are written to file.
+ *
+ * The remap is set up from the VERTICAL REMAP sublist of the stream parameters
+ * (see scorpio_output.hpp):
+ *
+ *   VERTICAL REMAP:
+ *     COORDINATE: STRING      (Pressure or Height)
+ *     LEVELS: [REAL,...]      (in Pa for Pressure, in m for Height)
+ *
+ * Fields defined over (COL,LEV) are interpolated using p_mid (or z_mid), while
+ * fields defined over (COL,ILEV) use p_int (or z_int). The interpolation is
+ * linear in log(p) for pressure levels, and linear in z for height levels.
+ * Target levels outside the model column (e.g., below the surface) get the
+ * value at the closest model level. Other fields are not affected by the remap.
+ *
+ * The remapped fields have the layout (COL,PLEV) or (COL,ZLEV), and are only
+ * computed when the output stream samples them.
+ */
+
+class OutputVerticalRemap
+{
+public:
+  using field_mgr_type = FieldManager<Real>;
+  using field_type     = Field<Real>;
+
+  enum class Coordinate {
+    Pressure,
+    Height
+  };
+
+  OutputVerticalRemap (const std::shared_ptr<const field_mgr_type>& field_mgr,
+                       const ekat::ParameterList& params);
+
+  Coordinate coordinate () const { return m_coordinate; }
+
+  // The name of the target levels dimension (and coordinate variable) in the output file
+  std::string coordinate_name () const;
+
+  // The target levels, as given in the parameter list
+  const std::vector<Real>& target_levels () const { return m_levels; }
+
+  // Whether a field is remapped, i.e., whether it is defined over (COL,LEV) or (COL,ILEV)
+  bool can_remap (const field_type& src) const;
+
+  // Create (and allocate) the field storing the remap of src on the target levels
+  field_type create_target_field (const field_type& src) const;
+
+  // Interpolate src to the target levels, and store the result in tgt.
+  // The time stamp of tgt is set to the one of src.
+  void remap (const field_type& src, field_type& tgt) const;
+
+protected:
+
+  // The name of the field storing the vertical coordinate for fields on midpoints/interfaces
+  std::string get_coordinate_field_name (const bool interfaces) const;
+
+  std::shared_ptr<const field_mgr_type>   m_field_mgr;
+  Coordinate                              m_coordinate;
+  std::vector<Real>                       m_levels;
+
+  // The target levels on device. For pressure levels, store log(p), since
+  // the interpolation is linear in log(p).
+  KokkosTypes<DefaultDevice>::view_1d<Real>  m_levels_coord;
+};
+
+} // namespace scream
+
+#endif // SCREAM_OUTPUT_VERTICAL_REMAP_HPP
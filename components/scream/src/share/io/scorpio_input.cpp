@@ -29,7 +29,7 @@ pull_input(const std::string& filename, const std::string& var_name,
   register_infile(filename);
 
   // Register the variable information in PIO
-  std::string io_decomp_tag = get_io_decomp(var_dims);
+  std::string io_decomp_tag = get_io_decomp(var_dims,has_columns);
   get_variable(filename, var_name, var_name, var_dims.size(), var_dims, PIO_REAL, io_decomp_tag);
 
   // Determine the degree's of freedom for this variable on this rank, and register with PIO
@@ -189,6 +189,9 @@ void AtmosphereInput::init()
 
   // Register new netCDF file for input.
   register_infile(m_filename);
+  if (m_params.isParameter("TIME INDEX")) {
+    set_read_time_index(m_filename,m_params.get<int>("TIME INDEX"));
+  }
 
   // Register variables with netCDF file.  Must come after dimensions are registered.
   register_variables();
@@ -221,7 +224,7 @@ void AtmosphereInput::register_variables()
 
     // Determine the IO-decomp and construct a vector of dimension ids for this variable:
     std::vector<std::string> vec_of_dims = get_vec_of_dims(fid.get_layout());
-    std::string io_decomp_tag           = get_io_decomp(vec_of_dims);
+    std::string io_decomp_tag           = get_io_decomp(vec_of_dims,fid.get_layout().has_tag(ShortFieldTagsNames::COL));
     get_variable(m_filename, name, name, vec_of_dims.size(), vec_of_dims, PIO_REAL, io_decomp_tag);
     // TODO  Need to change dtype to allow for other variables. 
     //  Currently the field_manager only stores Real variables so it is not an issue,
@@ -253,7 +256,7 @@ AtmosphereInput::get_vec_of_dims(const FieldLayout& layout)
 }
 
 /* ---------------------------------------------------------- */
-std::string AtmosphereInput::get_io_decomp(const std::vector<std::string>& dims_names)
+std::string AtmosphereInput::get_io_decomp(const std::vector<std::string>& dims_names, const bool has_cols)
 {
 /* Given a vector of field dimensions, create a unique decomp string to register with I/O/
  * Note: We are hard-coding for only REAL input here.  TODO: would be to allow for other dtypes
@@ -262,6 +265,11 @@ std::string AtmosphereInput::get_io_decomp(const std::vector<std::string>& dims_
   for (const auto& dim : dims_names) {
     io_decomp_tag += "-" + dim;
   }
+  // The decompositions are cached by tag for the whole run, and the one of an ensemble input
+  // (see get_var_dof_offsets) must not be reused by other reads with the same dimensions.
+  if (has_cols and is_ensemble_input()) {
+    io_decomp_tag += "-ensemble";
+  }
 
   return io_decomp_tag;
 }
@@ -298,6 +306,13 @@ void AtmosphereInput::set_degrees_of_freedom()
   // TODO: Gather DOF info directly from grid manager
 } // set_degrees_of_freedom
 
+/* ---------------------------------------------------------- */
+bool AtmosphereInput::is_ensemble_input() const
+{
+  const bool ensemble_input = m_params.isParameter("ENSEMBLE INPUT") && m_params.get<bool>("ENSEMBLE INPUT");
+  return ensemble_input and m_grid_mgr->get_grid(m_grid_name)->get_num_ensemble_members()>1;
+}
+
 /* ---------------------------------------------------------- */
 std::vector<Int> AtmosphereInput::get_var_dof_offsets(const int dof_len, const bool has_cols)
 {
@@ -319,6 +334,19 @@ std::vector<Int> AtmosphereInput::get_var_dof_offsets(const int dof_len, const b
     Int offset = 0;
     m_comm.scan_sum(&num_cols,&offset,1);
 
+    // In ensemble runs, the file may store the columns of one member only (see ENSEMBLE INPUT above),
+    // which are then read by all members.
+    if (is_ensemble_input()) {
+      const auto grid = m_grid_mgr->get_grid(m_grid_name);
+      const int num_members = grid->get_num_ensemble_members();
+      const int num_member_cols = grid->get_num_global_dofs() / num_members;
+      for (int icol=0; icol<num_cols; ++icol) {
+        const Int file_col = (offset+icol) % num_member_cols;
+        std::iota(var_dof.begin()+icol*col_size, var_dof.begin()+(icol+1)*col_size, file_col*col_size);
+      }
+      return var_dof;
+    }
+
     // Compute offsets of all my dofs
     std::iota(var_dof.begin(), var_dof.end(), offset*col_size);
   } else {
@@ -25,9 +25,9 @@
  *
  *  The typical input call will be to the outward facing routine 'pull_input'.
  *
- *  Currently, input can only handle single timesnap input files.  In other words
- *  files that will be opened, read and closed within the same timestep and only
- *  store one timesnap of data.
+ *  Currently, input only reads one timesnap of a file (the first one, unless TIME INDEX
+ *  is given below).  In other words files will be opened, read and closed within the
+ *  same timestep.
  *
  *  Note: the init, and finalize are separate routines that are outward facing in
  *  this class to facilitate cases where reading input over some number of simulation
@@ -53,6 +53,8 @@
  *      field_1: STRING
  *      ...
  *      field_N: STRING
+ *    ENSEMBLE INPUT: BOOL     (optional)
+ *    TIME INDEX: INT          (optional)
  *  -----
  *  where,
  *  FILENAME: is a string value of the name of the input file to be read.
@@ -60,6 +62,9 @@
  *  FIELDS: designation of a sublist, so empty here
  *    Number of Fields: is an integer value>0 telling the number of fields
  *    field_x: is the xth field variable name.  Should match the name in the file and the name in the field manager.  TODO: add a rename option if variable names differ in file and field manager.
+ *  ENSEMBLE INPUT: if true, and the grid stacks the columns of several ensemble members, the file only stores the columns of one member,
+ *    and all members read the same columns (e.g., to initialize all members from the same initial condition file). Defaults to false.
+ *  TIME INDEX: the (1-based) time slice to read from the file. Defaults to 1.
  *
  * Usage:
  * 1. Construct an instance of the AtmosphereInput class:
@@ -146,9 +151,12 @@ protected:
   void set_degrees_of_freedom();
 
   std::vector<std::string> get_vec_of_dims (const FieldLayout& layout);
-  std::string get_io_decomp (const std::vector<std::string>& vec_of_dims);
+  std::string get_io_decomp (const std::vector<std::string>& vec_of_dims, const bool has_cols);
   std::vector<Int> get_var_dof_offsets (const int dof_len, const bool has_cols);
 
+  // Whether all ensemble members read the same file columns (see ENSEMBLE INPUT above)
+  bool is_ensemble_input () const;
+
   // Internal variables
   ekat::ParameterList m_params;
   ekat::Comm          m_comm;
@@ -1,10 +1,33 @@
 #include "share/io/scorpio_output.hpp"
 
+#include <cmath>
+#include <limits>
 #include <numeric>
 
 namespace scream
 {
 
+namespace {
+// Copy the columns with local ids lids of a field view (where columns are the slowest dimension) into dst.
+void gather_columns (const KokkosTypes<DefaultDevice>::view_1d<Real>& src,
+                     const KokkosTypes<DefaultDevice>::view_1d<int>& lids,
+                     const KokkosTypes<DefaultDevice>::view_1d<Real>& dst)
+{
+  using ExeSpace = KokkosTypes<DefaultDevice>::ExeSpace;
+  const int num_cols = lids.extent(0);
+  if (num_cols==0) {
+    return;
+  }
+  const int col_size = dst.extent(0) / num_cols;
+  Kokkos::parallel_for("gather_columns", Kokkos::RangePolicy<ExeSpace>(0,dst.extent(0)),
+                       KOKKOS_LAMBDA (const int idx) {
+    const int icol = idx / col_size;
+    const int i    = idx % col_size;
+    dst(idx) = src(lids(icol)*col_size + i);
+  });
+}
+} // anonymous namespace
+
 // ====================== IMPLEMENTATION ===================== //
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::init()
@@ -36,23 +59,80 @@ void AtmosphereOutput::init()
   MPI_Allreduce(&m_local_dofs, &m_total_dofs, 1, MPI_INT, MPI_SUM, m_comm.mpi_comm());
   EKAT_REQUIRE_MSG(m_comm.size()<=m_total_dofs,"Error, PIO interface only allows for the IO comm group size to be less than or equal to the total # of columns in grid.  Consider decreasing size of IO comm group.\n");
 
+  // Optionally, only write some of the columns (see COLUMNS above). Note: this resets m_total_dofs.
+  if (m_params.isSublist("COLUMNS")) {
+    set_column_subset(m_params.sublist("COLUMNS"));
+  }
+  // In ensemble runs, the columns of a member are the global dofs [member*N,(member+1)*N) (see abstract_grid.hpp).
+  if (m_params.isParameter("ENSEMBLE MEMBER")) {
+    EKAT_REQUIRE_MSG(not m_is_restart and not m_params.isSublist("COLUMNS"),
+        "Error! ENSEMBLE MEMBER is not allowed for restart output or together with COLUMNS, in " + m_casename + ".\n");
+    const auto grid = m_grid_mgr->get_grid(m_grid_name);
+    const int num_members = grid->get_num_ensemble_members();
+    const int member = m_params.get<Int>("ENSEMBLE MEMBER");
+    EKAT_REQUIRE_MSG(member>=0 and member<num_members,
+        "Error! ENSEMBLE MEMBER " + std::to_string(member) + " is out of range, in " + m_casename + ".\n"
+        "       Number of ensemble members: " + std::to_string(num_members) + "\n");
+    const int num_member_cols = grid->get_num_global_dofs() / num_members;
+    std::vector<int> member_gids(num_member_cols);
+    std::iota(member_gids.begin(),member_gids.end(),member*num_member_cols);
+    ekat::ParameterList cols_params("COLUMNS");
+    cols_params.set("GIDS",member_gids);
+    set_column_subset(cols_params);
+  }
+  // The same PIO limitation applies to the subset of columns in the file.
+  EKAT_REQUIRE_MSG(not m_subset_columns or m_comm.size()<=m_total_dofs,
+      "Error! PIO interface only allows for the IO comm group size to be less than or equal to the # of columns in the file,\n"
+      "       but COLUMNS or ENSEMBLE MEMBER select only " + std::to_string(m_total_dofs) + " columns, in " + m_casename + ".\n"
+      "       Consider decreasing size of IO comm group.\n");
+  m_buffer_steps = m_params.get<Int>("BUFFER STEPS",1);
+  EKAT_REQUIRE_MSG(m_buffer_steps>0, "Error! BUFFER STEPS must be positive, in " + m_casename + ".\n");
+  EKAT_REQUIRE_MSG(m_buffer_steps==1 or (not m_is_restart and m_restart_hist_n==0),
+      "Error! BUFFER STEPS is not allowed for restart output or with restart history output, in " + m_casename + ".\n");
+
+  // Fields on model levels are written on the target levels of the vertical remap, if any (see output_vertical_remap.hpp).
+  if (m_params.isSublist("VERTICAL REMAP")) {
+    EKAT_REQUIRE_MSG(not m_is_restart,
+        "Error! Vertical remap is not allowed in restart output streams, in " + m_casename + ".\n");
+    m_vertical_remap = std::make_shared<OutputVerticalRemap>(m_field_mgr,m_params.sublist("VERTICAL REMAP"));
+  }
+
   // Create map of fields in this output with the field_identifier in the field manager.
+  // Fields that are not in the field manager must be output diagnostics (see output_diagnostics.hpp).
   auto& var_params = m_params.sublist("FIELDS");
   for (int var_i=0; var_i<var_params.get<Int>("Number of Fields");++var_i)
   {
     // Determine the variable name 
     std::string var_name = var_params.get<std::string>(ekat::strint("field",var_i+1));
     m_fields.push_back(var_name);
+    if (not m_field_mgr->has_field(var_name)) {
+      if (m_diagnostics==nullptr) {
+        m_diagnostics = std::make_shared<OutputDiagnostics>(m_field_mgr);
+      }
+      m_diag_fields.emplace(var_name,m_diagnostics->get_diagnostic(var_name));
+    }
+    if (m_vertical_remap!=nullptr) {
+      const auto src = get_source_field(var_name);
+      if (m_vertical_remap->can_remap(src)) {
+        m_remapped_fields.emplace(var_name,m_vertical_remap->create_target_field(src));
+      }
+    }
     /* Check that all dimensions for this variable are set to be registered */
     register_dimensions(var_name);
   }
 
   // Now that the fields have been gathered register the local views which will be used to determine output data to be written.
   register_views();
+  register_encodings();
 
   // If this is a restart run that requires a restart history file read input here:
   if (m_read_restart_hist)
   {
+    // TODO: the restart history input reads fields through the field manager, so it cannot handle diagnostics,
+    //       vertically remapped fields, or column subsets yet.
+    EKAT_REQUIRE_MSG((m_diag_fields.empty() and m_remapped_fields.empty() and not m_subset_columns) or m_avg_type=="Instant",
+        "Error! Restart history files are not supported yet for output streams with diagnostics, vertical remap,\n"
+        "       or column subsets, in " + m_casename + ".\n");
     std::ifstream rpointer_file;
     rpointer_file.open("rpointer.atm");
     std::string filename;
@@ -187,20 +267,43 @@ void AtmosphereOutput::run_impl(const Real time, const std::string& time_str)
     filename = m_filename;
     if( !m_is_init and is_typical ) { m_is_init=true; }
 
-    pio_update_time(filename,time); // Universal scorpio command to set the timelevel for this snap.
+    // Universal scorpio command to set the timelevel for this snap. Buffered snaps set it when they are written.
+    if (is_typical and m_buffer_steps>1) {
+      m_buffered_times.push_back(time);
+    } else {
+      pio_update_time(filename,time);
+    }
     if (is_typical) { m_status["Snaps"] += 1; }  // Update the snap tally, used to determine if a new file is needed and only needed for typical output.
   }
 
+  // Instantaneous output only needs the fields at the steps where they are written.
+  if (m_avg_type == "Instant" and not is_write) { return; }
+
   // Take care of updating and possibly writing fields.
   for (auto const& name : m_fields)
   {
-    // Get all the info for this field.
-    auto field = m_field_mgr->get_field(name);
+    // Get all the info for this field. Diagnostics and vertical remaps are only computed here, i.e. when they are needed.
+    auto diag = m_diag_fields.find(name);
+    if (diag!=m_diag_fields.end()) {
+      diag->second->compute();
+    }
+    auto remapped = m_remapped_fields.find(name);
+    if (remapped!=m_remapped_fields.end()) {
+      m_vertical_remap->remap(get_source_field(name),remapped->second);
+    }
+    auto field = get_field(name);
     auto view_d = field.get_view();
+    // For a column subset, only copy the selected columns to host.
+    auto subset_view = m_subset_views.find(name);
+    if (subset_view!=m_subset_views.end()) {
+      gather_columns(view_d,m_subset_lids,subset_view->second);
+      view_d = subset_view->second;
+    }
     auto g_view = Kokkos::create_mirror_view( view_d );
     Kokkos::deep_copy(g_view, view_d);
-    Int  f_len  = field.get_header().get_identifier().get_layout().size();
     auto l_view = m_view_local.at(name);
+    // Note: loop over the whole allocation. Padding entries are not written to file (see set_degrees_of_freedom).
+    Int  f_len  = l_view.size();
     // It is not necessary to do any operations between local and global views if the frequency of output is instantaneous,
     // or if the Average Counter is 1 (meaning the beginning of a new record).
     // TODO: Question to address - This current approach will *not* include the initial conditions in the calculation of any of the
@@ -228,9 +331,22 @@ void AtmosphereOutput::run_impl(const Real time, const std::string& time_str)
       }
     } // m_avg_type != "Instant"
     if (is_write) {
-      auto l_dims = field.get_header().get_identifier().get_layout().dims();
-      Int padding = field.get_header().get_alloc_properties().get_padding();
-      grid_write_data_array(filename,name,l_dims,m_dofs.at(name),padding,l_view.data());
+      const auto& enc = m_encodings.at(name);
+      if (is_typical and m_buffer_steps>1) {
+        // Keep a copy of the (possibly rounded) data, to be written later.
+        auto& buffer = m_buffered_data[name];
+        const auto offset = buffer.size();
+        buffer.insert(buffer.end(),l_view.data(),l_view.data()+f_len);
+        if (enc.significant_digits>0) {
+          quantize_significant_digits(buffer.data()+offset,f_len,enc.significant_digits);
+        }
+      } else if (enc.significant_digits>0 and not (m_is_restart or is_rhist)) {
+        m_rounded_data.assign(l_view.data(),l_view.data()+f_len);
+        quantize_significant_digits(m_rounded_data.data(),f_len,enc.significant_digits);
+        grid_write_data_array(m_var_handles.at(name),m_dofs.at(name),m_rounded_data.data());
+      } else {
+        grid_write_data_array(m_var_handles.at(name),m_dofs.at(name),l_view.data());
+      }
       if (is_typical) { 
         for (int ii=0; ii<f_len; ++ii) { l_view(ii) = g_view(ii); }  // Reset local view after writing.  Only for typical output.
       }
@@ -240,6 +356,11 @@ void AtmosphereOutput::run_impl(const Real time, const std::string& time_str)
   // Finish up any updates to output file and snap counter.
   if (is_write)
   {
+    // Write the buffered snaps once the buffer is full, or before closing the file.
+    const bool file_full = is_typical and m_status["Snaps"] == m_out_max_steps;
+    if (m_buffered_times.size()>0 and (static_cast<Int>(m_buffered_times.size())==m_buffer_steps or file_full)) {
+      write_buffered_snaps(filename);
+    }
     sync_outfile(filename);
     // If snaps equals max per file, close this file and set flag to open a new one next write step.
     if (is_typical)
@@ -268,7 +389,11 @@ void AtmosphereOutput::finalize()
   using namespace scream;
   using namespace scream::scorpio;
 
-  // Nothing to do at the moment, but keep just in case future development needs a finalization step
+  // Write the snaps that are still buffered.
+  if (m_buffered_times.size()>0) {
+    write_buffered_snaps(m_filename);
+    sync_outfile(m_filename);
+  }
 
   m_status["Finalize"] += 1;
 } // finalize
@@ -282,7 +407,7 @@ void AtmosphereOutput::register_dimensions(const std::string& name)
  *   name: is a string name of the variable who is to be added to the list of variables in this IO stream.
  */
   using namespace scorpio;
-  auto fid = m_field_mgr->get_field(name).get_header().get_identifier();
+  auto fid = get_field(name).get_header().get_identifier();
   // check to see if all the dims for this field are already set to be registered.
   for (int ii=0; ii<fid.get_layout().rank(); ++ii)
   {
@@ -316,16 +441,161 @@ void AtmosphereOutput::register_views()
   // Cycle through all fields and register.
   for (auto const& name : m_fields)
   {
-    auto field = m_field_mgr->get_field(name);
+    auto field = get_field(name);
     // If the "averaging type" is instant then just need a ptr to the view.
     EKAT_REQUIRE_MSG (field.get_header().get_parent().expired(), "Error! Cannot deal with subfield, for now.");
     auto view_d = field.get_view();
     // Create a local copy of view to be stored by output stream.
-    view_type_host view_copy("",view_d.extent(0));
+    // For a column subset, the local copy (and the device view gathering the columns) only store the selected columns.
+    Int view_len = view_d.extent(0);
+    const auto& layout = field.get_header().get_identifier().get_layout();
+    if (m_subset_columns and layout.has_tag(ShortFieldTagsNames::COL)) {
+      EKAT_REQUIRE_MSG(layout.tag(0)==ShortFieldTagsNames::COL,
+          "Error! Column subsets require COL to be the first dimension, for field " + name + ".\n");
+      view_len = (view_d.extent(0)/m_gids_host.size())*m_subset_file_idx.size();
+      m_subset_views.emplace(name,KokkosTypes<DefaultDevice>::view_1d<Real>(name+"_columns",view_len));
+    }
+    view_type_host view_copy("",view_len);
     m_view_local.emplace(name,view_copy);
   }
 }
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::set_column_subset(const ekat::ParameterList& params)
+{
+  // Resolve the requested columns to the local columns of each rank.
+  // For each requested column, lids[i] is the local id of the column on this rank, or -1 if not owned.
+  const int num_lcols = m_gids_host.size();
+  std::vector<int> lids;
+  if (params.isParameter("GIDS")) {
+    std::map<AbstractGrid::gid_type,int> gid2lid;
+    for (int icol=0; icol<num_lcols; ++icol) {
+      gid2lid[m_gids_host(icol)] = icol;
+    }
+    for (auto gid : params.get<std::vector<int>>("GIDS")) {
+      auto it = gid2lid.find(gid);
+      lids.push_back(it==gid2lid.end() ? -1 : it->second);
+    }
+  } else {
+    // The yaml parser stores a list of integers as ints.
+    auto get_reals = [&](const std::string& name) {
+      std::vector<double> vals;
+      if (params.isType<std::vector<int>>(name)) {
+        for (auto v : params.get<std::vector<int>>(name)) { vals.push_back(v); }
+      } else {
+        vals = params.get<std::vector<double>>(name);
+      }
+      return vals;
+    };
+    const auto lats = get_reals("LAT");
+    const auto lons = get_reals("LON");
+    EKAT_REQUIRE_MSG(lats.size()==lons.size(),
+        "Error! COLUMNS LAT and LON must have the same length, in " + m_casename + ".\n");
+
+    const auto grid = m_grid_mgr->get_grid(m_grid_name);
+    auto lat_h = Kokkos::create_mirror_view(grid->get_geometry_data("lat"));
+    auto lon_h = Kokkos::create_mirror_view(grid->get_geometry_data("lon"));
+    Kokkos::deep_copy(lat_h,grid->get_geometry_data("lat"));
+    Kokkos::deep_copy(lon_h,grid->get_geometry_data("lon"));
+
+    // Find the closest local column to each point (great circle distance, via the haversine formula),
+    // then the closest column over all ranks. Ties go to the lowest rank.
+    const double deg2rad = std::acos(-1.0)/180;
+    const int num_points = lats.size();
+    // Note: the layout of this struct matches MPI_DOUBLE_INT.
+    struct DistRank { double dist; int rank; };
+    std::vector<DistRank> local(num_points), global(num_points);
+    std::vector<int> closest(num_points,-1);
+    for (int ip=0; ip<num_points; ++ip) {
+      local[ip].dist = std::numeric_limits<double>::max();
+      local[ip].rank = m_comm.rank();
+      for (int icol=0; icol<num_lcols; ++icol) {
+        const double dlat = (lat_h(icol)-lats[ip])*deg2rad;
+        const double dlon = (lon_h(icol)-lons[ip])*deg2rad;
+        const double a = std::pow(std::sin(dlat/2),2) +
+                         std::cos(lats[ip]*deg2rad)*std::cos(lat_h(icol)*deg2rad)*std::pow(std::sin(dlon/2),2);
+        if (a<local[ip].dist) {
+          local[ip].dist = a;
+          closest[ip] = icol;
+        }
+      }
+    }
+    MPI_Allreduce(local.data(),global.data(),num_points,MPI_DOUBLE_INT,MPI_MINLOC,m_comm.mpi_comm());
+    for (int ip=0; ip<num_points; ++ip) {
+      lids.push_back(global[ip].rank==m_comm.rank() ? closest[ip] : -1);
+    }
+  }
+
+  // Each requested column must be owned by exactly one rank.
+  const int num_req = lids.size();
+  EKAT_REQUIRE_MSG(num_req>0, "Error! COLUMNS must select at least one column, in " + m_casename + ".\n");
+  std::vector<int> owned(num_req), num_owners(num_req);
+  for (int i=0; i<num_req; ++i) {
+    owned[i] = lids[i]>=0 ? 1 : 0;
+  }
+  MPI_Allreduce(owned.data(),num_owners.data(),num_req,MPI_INT,MPI_SUM,m_comm.mpi_comm());
+  for (int i=0; i<num_req; ++i) {
+    EKAT_REQUIRE_MSG(num_owners[i]==1,
+        "Error! Requested column " + std::to_string(i) + " in COLUMNS of " + m_casename + " was not found in the grid.\n");
+  }
+
+  std::vector<int> my_lids;
+  for (int i=0; i<num_req; ++i) {
+    if (lids[i]>=0) {
+      my_lids.push_back(lids[i]);
+      m_subset_file_idx.push_back(i);
+    }
+  }
+  m_subset_lids = KokkosTypes<DefaultDevice>::view_1d<int>("subset lids",my_lids.size());
+  auto lids_h = Kokkos::create_mirror_view(m_subset_lids);
+  std::copy(my_lids.begin(),my_lids.end(),lids_h.data());
+  Kokkos::deep_copy(m_subset_lids,lids_h);
+
+  m_subset_columns = true;
+  m_total_dofs = num_req;
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::register_encodings()
+{
+  using namespace scream::scorpio;
+
+  // Parse the encoding parameters in the given list, using the given encoding for the missing ones.
+  auto parse_encoding = [&](const ekat::ParameterList& params, const FieldEncoding& defaults, const std::string& where) {
+    FieldEncoding enc = defaults;
+    if (params.isParameter("DATA TYPE")) {
+      const auto& dtype = params.get<std::string>("DATA TYPE");
+      if (dtype=="Native") {
+        enc.nc_dtype = PIO_REAL;
+      } else if (dtype=="Single") {
+        enc.nc_dtype = PIO_FLOAT;
+      } else if (dtype=="Double") {
+        enc.nc_dtype = PIO_DOUBLE;
+      } else {
+        EKAT_ERROR_MSG("Error! Unsupported DATA TYPE '" + dtype + "' for " + where + ".\n"
+                       "       Valid options are: Native, Single, Double.\n");
+      }
+    }
+    enc.significant_digits = params.get<Int>("SIGNIFICANT DIGITS",enc.significant_digits);
+    enc.deflate_level      = params.get<Int>("COMPRESSION LEVEL",enc.deflate_level);
+    EKAT_REQUIRE_MSG(enc.significant_digits>=0,
+        "Error! SIGNIFICANT DIGITS must be non-negative, for " + where + ".\n");
+    EKAT_REQUIRE_MSG(enc.deflate_level>=0 && enc.deflate_level<=9,
+        "Error! COMPRESSION LEVEL must be in [0,9], for " + where + ".\n");
+    return enc;
+  };
+
+  const auto stream_enc = parse_encoding(m_params,FieldEncoding(),"output stream " + m_casename);
+  const bool has_field_encs = m_params.isSublist("FIELD ENCODINGS");
+  for (auto const& name : m_fields)
+  {
+    if (has_field_encs && m_params.sublist("FIELD ENCODINGS").isSublist(name)) {
+      const auto& field_params = m_params.sublist("FIELD ENCODINGS").sublist(name);
+      m_encodings.emplace(name,parse_encoding(field_params,stream_enc,"field " + name + " in output stream " + m_casename));
+    } else {
+      m_encodings.emplace(name,stream_enc);
+    }
+  }
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::register_variables(const std::string& filename)
 {
   using namespace scorpio;
@@ -333,7 +603,7 @@ void AtmosphereOutput::register_variables(const std::string& filename)
   // Cycle through all fields and register.
   for (auto const& name : m_fields)
   {
-    auto field = m_field_mgr->get_field(name);
+    auto field = get_field(name);
     auto& fid  = field.get_header().get_identifier();
     // Determine the IO-decomp and construct a vector of dimension ids for this variable:
     std::string io_decomp_tag = "Real";  // Note, for now we only assume REAL variables.  This may change in the future.
@@ -344,14 +614,35 @@ void AtmosphereOutput::register_variables(const std::string& filename)
       io_decomp_tag += "-" + tag_name; // Concatenate the dimension string to the io-decomp string
       vec_of_dims.push_back(tag_name); // Add dimensions string to vector of dims.
     }
+    // The dofs of padded fields include the padding (see set_degrees_of_freedom), so they need their own decomposition.
+    const Int padding = field.get_header().get_alloc_properties().get_padding();
+    if (padding>0) {
+      io_decomp_tag += "-pad" + std::to_string(padding);
+    }
+    // A column subset has its own decomposition, even if the dimensions are the same as other files.
+    if (m_subset_columns and layout.has_tag(ShortFieldTagsNames::COL)) {
+      io_decomp_tag += "-" + m_casename;
+    }
     io_decomp_tag += "-time";  // TODO: Do we expect all vars to have a time dimension?  If not then how to trigger?  Should we register dimension variables (such as ncol and lat/lon) elsewhere in the dimension registration?  These won't have time.
     std::reverse(vec_of_dims.begin(),vec_of_dims.end()); // TODO: Reverse order of dimensions to match flip between C++ -> F90 -> PIO, may need to delete this line when switching to fully C++/C implementation.
     vec_of_dims.push_back("time");  //TODO: See the above comment on time.
-    register_variable(filename, name, name, vec_of_dims.size(), vec_of_dims, PIO_REAL, io_decomp_tag);  // TODO  Need to change dtype to allow for other variables.  Currently the field_manager only stores Real variables so it is not an issue, but in the future if non-Real variables are added we will want to accomodate that.
+    // Note: the data in memory is always Real, but it can be stored in the file with a different type.
+    //       Restart (history) files use the native type, so that restarts are exact.
+    const auto& enc = m_encodings.at(name);
+    if (m_is_restart or m_is_restart_hist) {
+      register_variable(filename, name, name, vec_of_dims.size(), vec_of_dims, PIO_REAL, io_decomp_tag);
+    } else {
+      register_variable(filename, name, name, vec_of_dims.size(), vec_of_dims, PIO_REAL, io_decomp_tag, enc.nc_dtype, enc.deflate_level);
+    }
   }
   // Finish by registering time as a variable.  TODO: Should this really be something registered during the reg. dimensions step? 
   register_variable(filename,"time","time",1,{"time"},  PIO_REAL,"time");
   if (m_is_restart_hist) { register_variable(filename,"avg_count","avg_count",1,{"cnt"}, PIO_REAL, "cnt"); }
+  // The target levels of the vertical remap, as a coordinate variable.
+  if (not m_remapped_fields.empty()) {
+    const auto coord_name = m_vertical_remap->coordinate_name();
+    register_variable(filename,coord_name,coord_name,1,{coord_name}, PIO_REAL, coord_name);
+  }
 } // register_variables
 /* ---------------------------------------------------------- */
 std::vector<Int> AtmosphereOutput::get_var_dof_offsets(const int dof_len, const bool has_cols)
@@ -370,6 +661,15 @@ std::vector<Int> AtmosphereOutput::get_var_dof_offsets(const int dof_len, const
     //       E.g., (ncols,2,nlevs), or (ncols,2) respectively.
     Int col_size = dof_len/num_cols;
 
+    // For a column subset, the position of each selected column in the file is given.
+    if (m_subset_columns) {
+      var_dof.resize(m_subset_file_idx.size()*col_size);
+      for (size_t icol=0; icol<m_subset_file_idx.size(); ++icol) {
+        std::iota(var_dof.begin()+icol*col_size, var_dof.begin()+(icol+1)*col_size, m_subset_file_idx[icol]*col_size);
+      }
+      return var_dof;
+    }
+
     // Compute the number of columns owned by all previous ranks.
     Int offset = 0;
     m_comm.scan_sum(&num_cols,&offset,1);
@@ -392,12 +692,18 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
   // Cycle through all fields and set dof.
   for (auto const& name : m_fields)
   {
-    auto field = m_field_mgr->get_field(name);
+    auto field = get_field(name);
     auto& fid  = field.get_header().get_identifier();
     // Given dof_len and n_dim_len it should be possible to create an integer array of "global output indices" for this
     // field and this rank. For every column (i.e. gid) the PIO indices would be (gid * n_dim_len),...,( (gid+1)*n_dim_len - 1).
     const bool has_col_tag = fid.get_layout().has_tag(COL);
     std::vector<Int> var_dof = get_var_dof_offsets(fid.get_layout().size(), has_col_tag);
+    // If the field is padded, mark the padding entries as holes in the dofs, so that
+    // the padded local view can be written as is.
+    const Int padding = field.get_header().get_alloc_properties().get_padding();
+    if (padding>0) {
+      var_dof = get_padded_dof_offsets(var_dof, fid.get_layout().dims().back(), padding);
+    }
     set_dof(filename,name,var_dof.size(),var_dof.data());
     m_dofs.emplace(std::make_pair(name,var_dof.size()));
   }
@@ -407,11 +713,35 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
     Int var_dof[1] = {0};
     set_dof(filename,"avg_count",1,var_dof); 
    }
+  if (not m_remapped_fields.empty()) {
+    std::vector<Int> var_dof = get_var_dof_offsets(m_vertical_remap->target_levels().size(),false);
+    set_dof(filename,m_vertical_remap->coordinate_name(),var_dof.size(),var_dof.data());
+  }
   /* TODO: 
    * Gather DOF info directly from grid manager
   */
 } // set_degrees_of_freedom
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::write_buffered_snaps(const std::string& filename)
+{
+  using namespace scream::scorpio;
+
+  // Add all the buffered time levels to the file, then write all the buffered snaps
+  // of each field with a single (aggregated) write.
+  const int num_snaps = m_buffered_times.size();
+  for (int isnap=0; isnap<num_snaps; ++isnap) {
+    pio_update_time(filename,m_buffered_times[isnap]);
+  }
+  for (auto const& name : m_fields) {
+    const auto& buffer = m_buffered_data.at(name);
+    EKAT_REQUIRE_MSG (static_cast<Int>(buffer.size())==num_snaps*m_dofs.at(name),
+        "Error! Buffered data of field " + name + " does not match the number of buffered snaps.\n");
+    grid_write_data_array_frames(m_var_handles.at(name),num_snaps,buffer.size(),buffer.data());
+  }
+  m_buffered_times.clear();
+  m_buffered_data.clear();
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::new_file(const std::string& filename)
 {
   using namespace scream;
@@ -435,6 +765,18 @@ void AtmosphereOutput::new_file(const std::string& filename)
   // Finish the definition phase for this file.
   eam_pio_enddef  (filename); 
 
+  // Resolve the variables once, so that writes do not need to look them up by name.
+  m_var_handles.clear();
+  for (auto const& name : m_fields)
+  {
+    m_var_handles.emplace(name,get_var_handle(filename,name));
+  }
+
+  // The target levels of the vertical remap do not change, so write them once per file.
+  if (not m_remapped_fields.empty()) {
+    const auto& levels = m_vertical_remap->target_levels();
+    grid_write_data_array(filename,m_vertical_remap->coordinate_name(),levels.size(),levels.data());
+  }
 }
 /* ---------------------------------------------------------- */
 } // namespace scream
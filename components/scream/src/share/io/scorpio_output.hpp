@@ -13,6 +13,8 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/output_diagnostics.hpp"
+#include "share/io/output_vertical_remap.hpp"
 
 #include "share/field/field_manager.hpp"
 #include "share/field/field_header.hpp"
@@ -52,6 +54,23 @@
  *  restart_hist_N: INT            (optional)
  *  restart_hist_OPTION: STRING    (optional)
  *  RESTART FILE: BOOL             (optional)
+ *  DATA TYPE: STRING              (optional)
+ *  SIGNIFICANT DIGITS: INT        (optional)
+ *  COMPRESSION LEVEL: INT         (optional)
+ *  FIELD ENCODINGS:               (optional)
+ *    field_name:
+ *      DATA TYPE: STRING          (optional)
+ *      SIGNIFICANT DIGITS: INT    (optional)
+ *      COMPRESSION LEVEL: INT     (optional)
+ *  VERTICAL REMAP:                (optional)
+ *    COORDINATE: STRING
+ *    LEVELS: [REAL,...]
+ *  COLUMNS:                       (optional)
+ *    GIDS: [INT,...]              (either this,)
+ *    LAT: [REAL,...]              (or these two)
+ *    LON: [REAL,...]
+ *  BUFFER STEPS: INT              (optional)
+ *  ENSEMBLE MEMBER: INT           (optional)
  *  -----
  *  where,
  *  FILENAME is a string of the filename suffix.  TODO: change this to a casename associated with the whole run.
@@ -68,9 +87,38 @@
  *  FIELDS is a subsection that lists all the fields in this output stream.
  *    Number of Fields is an integer that specifies the number of fields in this output stream.
  *    field 1,...,field N is a list of each field in the output stream by name in field manager.
+ *      A name that is not in the field manager must be a diagnostic (e.g., LiqWaterPath), see output_diagnostics.hpp.
  *  restart_hist_N is an optional integer parameter that specifies the frequenct of restart history writes.
  *  restart_hist_OPTION is an optional string parameter for the units of restart history output.
  *  RESTART FILE is an optional boolean parameter that specifies if this output stream is a restart output, which is treated differently.
+ *  DATA TYPE is an optional string for the type of the variables in the file, current options are:
+ *    Native - the type of the data in memory, i.e. Real (default).
+ *    Single - single precision, which halves the file size when Real is double.
+ *    Double - double precision.
+ *  SIGNIFICANT DIGITS is an optional integer.  If positive, the data is rounded to this many significant (decimal) digits
+ *    before being written (bit-rounding), which makes it much more compressible.  Defaults to 0, meaning no rounding.
+ *  COMPRESSION LEVEL is an optional integer (0-9) for the lossless deflate compression of the variables.  Defaults to 0,
+ *    meaning no compression.  Compression is only available for netCDF4 files, and ignored for other PIO iotypes.
+ *  FIELD ENCODINGS is an optional subsection to override DATA TYPE, SIGNIFICANT DIGITS and COMPRESSION LEVEL for single fields,
+ *    e.g. to keep more digits for a field whose small variations matter.
+ *  Note: restart and restart history files are always written in the native type and without rounding, so that restarts are exact.
+ *  VERTICAL REMAP is an optional subsection to write the fields defined on model levels on a set of pressure or height levels instead,
+ *    see output_vertical_remap.hpp.  Only the requested levels are written, along with a coordinate variable (plev or zlev) storing them.
+ *    COORDINATE is either Pressure (LEVELS in Pa) or Height (LEVELS in m).
+ *    LEVELS is the list of target levels.
+ *  COLUMNS is an optional subsection to write only some columns of the grid (e.g., the columns closest to observation sites),
+ *    which makes high-frequency output affordable on large grids.  The columns are given either by their global ids (GIDS),
+ *    or by a list of points (LAT and LON, in the units of the grid lat/lon geometry data), in which case the closest column
+ *    to each point is used.  The columns are resolved once, at init, and gathered on device at each sampled step.
+ *    The ncol dimension of the file follows the order of the given list.
+ *    As for the whole grid, the number of columns in the file cannot be smaller than the size of the IO comm group.
+ *  BUFFER STEPS is an optional integer.  If larger than 1, the output snapshots are kept in memory, and written to file
+ *    this many at a time (or when the file is full, or at finalize), with one aggregated write per field for all the buffered
+ *    snapshots, which reduces the number of writes for frequent output.
+ *    Not allowed for restart files, or together with restart history output.
+ *  ENSEMBLE MEMBER is an optional integer.  In ensemble runs (see AbstractGrid::get_num_ensemble_members), only write the columns
+ *    of this member (starting from 0), so that each member gets its own output files.  Otherwise, the columns of all members are written.
+ *    Not allowed for restart files, or together with COLUMNS.
  *
  *  Usage of this class is to create an output file, write data to the file and close the file.
  *  This class keeps a running copy of data for all output fields locally to be used for the different averaging flags.
@@ -121,6 +169,10 @@ public:
   void run(const util::TimeStamp& time);
   void finalize();
 
+  // Set the diagnostics to use for fields that are not in the field manager, so that
+  // they can be shared with other output streams. Must be called before init.
+  void set_diagnostics(const std::shared_ptr<OutputDiagnostics>& diagnostics) { m_diagnostics = diagnostics; }
+
   // Helper Functions
   void check_status();
   std::map<std::string,Int> get_status() const { return m_status; }
@@ -132,14 +184,25 @@ protected:
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<Int> get_var_dof_offsets (const int dof_len, const bool has_cols);
   void register_views();
+  void register_encodings();
   void new_file(const std::string& filename);
   void run_impl(const Real time, const std::string& time_str);  // Actual run routine called by outward facing "run"
   void set_restart_hist_read( const bool bval ) { m_read_restart_hist = bval; }
+  void set_column_subset(const ekat::ParameterList& params);
+  void write_buffered_snaps(const std::string& filename);
+  Field<Real> get_field(const std::string& name) const;
+  Field<Real> get_source_field(const std::string& name) const;
   // Internal variables
   ekat::ParameterList                         m_params;
   ekat::Comm                                  m_comm;
   std::shared_ptr<const FieldManager<Real>>   m_field_mgr;
   std::shared_ptr<const GridsManager>         m_grid_mgr;
+  // Diagnostics in this output stream, computed only at the steps where they are sampled.
+  std::shared_ptr<OutputDiagnostics>          m_diagnostics;
+  std::map<std::string,std::shared_ptr<OutputDiagnostic>> m_diag_fields;
+  // Vertical remap of this output stream, and the remapped fields, computed only at the steps where they are sampled.
+  std::shared_ptr<OutputVerticalRemap>        m_vertical_remap;
+  std::map<std::string,Field<Real>>           m_remapped_fields;
   
   // Main output control data
   std::string m_casename;
@@ -159,10 +222,31 @@ protected:
   // Internal maps to the output fields, how the columns are distributed, the file dimensions and the global ids.
   std::vector<std::string>               m_fields;
   std::map<std::string,Int>              m_dofs;
+  // Handles of the variables in the currently open file, see get_var_handle.
+  std::map<std::string,int>              m_var_handles;
   std::map<std::string,Int>              m_dims;
   typename dofs_list_type::HostMirror    m_gids_host;
   // Local views of each field to be used for "averaging" output and writing to file.
   std::map<std::string,view_type_host>   m_view_local;
+  // How each field is stored in the file, see DATA TYPE, SIGNIFICANT DIGITS and COMPRESSION LEVEL above.
+  struct FieldEncoding {
+    int nc_dtype           = PIO_REAL;
+    int significant_digits = 0;
+    int deflate_level      = 0;
+  };
+  std::map<std::string,FieldEncoding>    m_encodings;
+  // Scratch buffer for the rounded data, so that the local views are not altered by the rounding.
+  std::vector<Real>                      m_rounded_data;
+  // Subset of the columns written to file, see COLUMNS above: the local ids of the selected columns
+  // owned by this rank, and their position in the file. The views gather the selected columns of each field.
+  bool                                   m_subset_columns = false;
+  std::vector<Int>                       m_subset_file_idx;
+  KokkosTypes<DefaultDevice>::view_1d<int>                m_subset_lids;
+  std::map<std::string,KokkosTypes<DefaultDevice>::view_1d<Real>>  m_subset_views;
+  // Snapshots not yet written to file, see BUFFER STEPS above.
+  Int                                    m_buffer_steps;
+  std::vector<Real>                      m_buffered_times;
+  std::map<std::string,std::vector<Real>> m_buffered_data;
 
   // Manage when files are open and closed, and what type of file I am writing.
   bool m_is_init = false;
@@ -183,6 +267,23 @@ protected:
 }; // Class AtmosphereOutput
 
 //// ====================== IMPLEMENTATION ===================== //
+inline Field<Real> AtmosphereOutput::get_field(const std::string& name) const
+{
+  // The field that is written to file, i.e., after the vertical remap (if any)
+  auto remapped = m_remapped_fields.find(name);
+  if (remapped!=m_remapped_fields.end()) {
+    return remapped->second;
+  }
+  return get_source_field(name);
+}
+inline Field<Real> AtmosphereOutput::get_source_field(const std::string& name) const
+{
+  auto diag = m_diag_fields.find(name);
+  if (diag!=m_diag_fields.end()) {
+    return diag->second->get_diagnostic();
+  }
+  return m_field_mgr->get_field(name);
+}
 inline void AtmosphereOutput::check_status()
 {
   printf("IO Status for Rank %5d, File - %.40s: (Init: %2d), (Run: %5d), (Finalize: %2d), (Avg. Count: %2d), (Snaps: %2d)\n",
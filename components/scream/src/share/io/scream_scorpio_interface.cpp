@@ -6,7 +6,12 @@
 
 #include "gptl.h"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <type_traits>
 
 using scream::Real;
 using scream::Int;
@@ -19,6 +24,11 @@ extern "C" {
   void grid_read_data_array_c2f_real(const char*&& filename, const char*&& varname, const Int dim1_length, Real *hbuf);
   void grid_read_data_array_c2f_int(const char*&& filename, const char*&& varname, const Int dim1_length, Int *hbuf);
 
+  int  get_var_handle_c2f(const char*&& filename, const char*&& varname);
+  void grid_read_data_array_c2f_real_handle(const int handle, const Int dim1_length, Real *hbuf);
+  void grid_write_data_array_c2f_real_handle(const int handle, const Int dim1_length, const Real* hbuf);
+  void grid_write_data_array_c2f_real_frames(const int handle, const int nframes, const Int dim1_length, const Real* hbuf);
+
   void grid_write_data_array_c2f_real_1d(const char*&& filename, const char*&& varname, const Int dim1_length, const Real* hbuf);
   void grid_write_data_array_c2f_real_2d(const char*&& filename, const char*&& varname, const Int dim1_length, const Int dim2_length, const Real* hbuf);
   void grid_write_data_array_c2f_real_3d(const char*&& filename, const char*&& varname, const Int dim1_length, const Int dim2_length, const Int dim3_length, const Real* hbuf);
@@ -33,8 +43,9 @@ extern "C" {
   void sync_outfile_c2f(const char*&& filename);
   void eam_pio_closefile_c2f(const char*&& filename);
   void pio_update_time_c2f(const char*&& filename,const Real time);
+  void eam_set_read_time_index_c2f(const char*&& filename,const int time_index);
   void register_dimension_c2f(const char*&& filename, const char*&& shortname, const char*&& longname, const int length);
-  void register_variable_c2f(const char*&& filename,const char*&& shortname, const char*&& longname, const int numdims, const char** var_dimensions, const int dtype, const char*&& pio_decomp_tag);
+  void register_variable_c2f(const char*&& filename,const char*&& shortname, const char*&& longname, const int numdims, const char** var_dimensions, const int dtype, const char*&& pio_decomp_tag, const int nc_dtype, const int deflate_level);
   void get_variable_c2f(const char*&& filename,const char*&& shortname, const char*&& longname, const int numdims, const char** var_dimensions, const int dtype, const char*&& pio_decomp_tag);
   void eam_pio_enddef_c2f(const char*&& filename);
 
@@ -95,6 +106,11 @@ void pio_update_time(const std::string& filename, const Real time) {
   pio_update_time_c2f(filename.c_str(),time);
 }
 /* ----------------------------------------------------------------- */
+void set_read_time_index(const std::string& filename, const int time_index) {
+
+  eam_set_read_time_index_c2f(filename.c_str(),time_index);
+}
+/* ----------------------------------------------------------------- */
 void register_dimension(const std::string &filename, const std::string& shortname, const std::string& longname, const int length) {
 
   register_dimension_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), length);
@@ -119,19 +135,27 @@ void get_variable(const std::string &filename, const std::string& shortname, con
 /* ----------------------------------------------------------------- */
 void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname, const int numdims, const std::vector<std::string>& var_dimensions, const int dtype, const std::string& pio_decomp_tag) {
 
+  register_variable(filename, shortname, longname, numdims, var_dimensions, dtype, pio_decomp_tag, dtype, 0);
+}
+/* ----------------------------------------------------------------- */
+void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname, const int numdims, const std::vector<std::string>& var_dimensions, const int dtype, const std::string& pio_decomp_tag, const int nc_dtype, const int deflate_level) {
+
+  EKAT_REQUIRE_MSG (deflate_level>=0 && deflate_level<=9,
+      "Error! Invalid deflate level " + std::to_string(deflate_level) + " for variable " + shortname + ". Valid levels are 0-9.\n");
+
   /* Convert the vector of strings that contains the variable dimensions to a char array */
   const char** var_dimensions_c = new const char*[numdims];
   for (int ii = 0;ii<numdims;++ii) 
   {
     var_dimensions_c[ii] = var_dimensions[ii].c_str();
   }
-  register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), numdims, var_dimensions_c, dtype, pio_decomp_tag.c_str());
+  register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), numdims, var_dimensions_c, dtype, pio_decomp_tag.c_str(), nc_dtype, deflate_level);
   delete[] var_dimensions_c;
 }
 /* ----------------------------------------------------------------- */
 void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname, const int numdims, const char**&& var_dimensions, const int dtype, const std::string& pio_decomp_tag) {
 
-  register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), numdims, var_dimensions, dtype, pio_decomp_tag.c_str());
+  register_variable_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), numdims, var_dimensions, dtype, pio_decomp_tag.c_str(), dtype, 0);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
@@ -198,6 +222,46 @@ void grid_write_data_array(const std::string &filename, const std::string &varna
 
 };
 /* ----------------------------------------------------------------- */
+int get_var_handle(const std::string &filename, const std::string &varname) {
+
+  return get_var_handle_c2f(filename.c_str(),varname.c_str());
+}
+/* ----------------------------------------------------------------- */
+void grid_read_data_array(const int var_handle, const Int& dim_length, Real *hbuf) {
+
+  grid_read_data_array_c2f_real_handle(var_handle,dim_length,hbuf);
+}
+/* ----------------------------------------------------------------- */
+void grid_write_data_array(const int var_handle, const Int& dim_length, const Real* hbuf) {
+
+  grid_write_data_array_c2f_real_handle(var_handle,dim_length,hbuf);
+}
+/* ----------------------------------------------------------------- */
+void grid_write_data_array_frames(const int var_handle, const int num_frames, const Int& dim_length, const Real* hbuf) {
+
+  grid_write_data_array_c2f_real_frames(var_handle,num_frames,dim_length,hbuf);
+}
+/* ----------------------------------------------------------------- */
+std::vector<Int> get_padded_dof_offsets(const std::vector<Int>& var_dof, const int last_dim_len, const int padding) {
+
+  if (padding==0) {
+    return var_dof;
+  }
+
+  // The allocation is padded along the last dimension: entry jj of the
+  // allocation is entry (jj / alloc_last_dim_len, jj % alloc_last_dim_len)
+  // of a 2d array whose fast dimension is last_dim_len long (plus padding).
+  const int alloc_last_dim_len = last_dim_len + padding;
+  const int slow_dim_len = var_dof.size() / last_dim_len;
+  std::vector<Int> padded_dof(slow_dim_len*alloc_last_dim_len,-1);
+  for (int ii=0; ii<slow_dim_len; ++ii) {
+    for (int jj=0; jj<last_dim_len; ++jj) {
+      padded_dof[ii*alloc_last_dim_len+jj] = var_dof[ii*last_dim_len+jj];
+    }
+  }
+  return padded_dof;
+}
+/* ----------------------------------------------------------------- */
 void add_remove_padding(const int slow_dim_len, const int pad_dim_len, const int padding, const Real *hbuf_in, Real *hbuf_out, bool add_padding)
 {
   int loc  = 0; // running tally of what index in the packed array we are at.
@@ -223,6 +287,42 @@ void add_remove_padding(const int slow_dim_len, const int pad_dim_len, const int
   }
 }
 /* ----------------------------------------------------------------- */
+void quantize_significant_digits(Real* hbuf, const Int dim_length, const int significant_digits)
+{
+  using bits_type = typename std::conditional<sizeof(Real)==8,std::uint64_t,std::uint32_t>::type;
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+
+  EKAT_REQUIRE_MSG (significant_digits>0,
+      "Error! The number of significant digits must be positive.\n");
+
+  // Number of mantissa bits needed to represent the requested decimal digits: log2(10) bits
+  // per digit. The implicit leading bit of the mantissa accounts for the rounding.
+  const int keep_bits = static_cast<int>(std::ceil(significant_digits*std::log2(10.0)));
+  if (keep_bits>=mantissa_bits) {
+    return;
+  }
+  const int drop_bits = mantissa_bits - keep_bits;
+  const bits_type half = bits_type(1) << (drop_bits-1);
+  const bits_type mask = ~((bits_type(1) << drop_bits) - 1);
+
+  for (Int i=0; i<dim_length; ++i) {
+    if (not std::isfinite(hbuf[i])) {
+      continue;
+    }
+    // Round to nearest, by adding half of the last kept bit before zeroing the dropped ones.
+    // Note: a carry into the exponent is fine, since it gives the correctly rounded value.
+    bits_type bits;
+    std::memcpy(&bits,&hbuf[i],sizeof(Real));
+    bits = (bits + half) & mask;
+    Real val;
+    std::memcpy(&val,&bits,sizeof(Real));
+    // Don't round the largest finite numbers to Inf
+    if (std::isfinite(val)) {
+      hbuf[i] = val;
+    }
+  }
+}
+/* ----------------------------------------------------------------- */
 
 } // namespace scorpio
 } // namespace scream
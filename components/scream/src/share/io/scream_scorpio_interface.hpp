@@ -18,6 +18,9 @@
   static constexpr int PIO_REAL = 6;
 #endif // SCREAM_CONFIG_IS_CMAKE
 static constexpr int PIO_INT = 4;
+// netCDF types of floating point variables in the file, which can differ from PIO_REAL (see register_variable)
+static constexpr int PIO_FLOAT  = 5;
+static constexpr int PIO_DOUBLE = 6;
 
 namespace scream {
 namespace scorpio {
@@ -35,13 +38,17 @@ namespace scorpio {
   void sync_outfile(const std::string& filename);
   /* Sets the IO decompostion for all variables in a particular filename.  Required after all variables have been registered.  Called once per file. */
   void set_decomp(const std::string& filename);
-  /* Sets the degrees-of-freedom for a particular variable in a particular file.  Called once for each variable, for each file. */
+  /* Sets the degrees-of-freedom for a particular variable in a particular file.  Called once for each variable, for each file.
+   * A negative offset marks an entry of the local array that is not read/written (e.g., padding, see get_padded_dof_offsets). */
   void set_dof(const std::string &filename, const std::string &varname, const Int dof_len, const Int* x_dof);
   /* Register a dimension coordinate with a file. Called during the file setup. */
   void register_dimension(const std::string& filename,const std::string& shortname, const std::string& longname, const int length);
   /* Register a variable with a file.  Called during the file setup, for an output stream. */
   void register_variable(const std::string& filename,const std::string& shortname, const std::string& longname, const int numdims, const char**&& var_dimensions, const int dtype, const std::string& pio_decomp_tag);
   void register_variable(const std::string& filename,const std::string& shortname, const std::string& longname, const int numdims, const std::vector<std::string>& var_dimensions, const int dtype, const std::string& pio_decomp_tag);
+  /* Same as above, but the variable is stored in the file with type nc_dtype (PIO converts data of type dtype when writing),
+   * and compressed with the given deflate level (0 means no compression; ignored unless the PIO iotype is netCDF4). */
+  void register_variable(const std::string& filename,const std::string& shortname, const std::string& longname, const int numdims, const std::vector<std::string>& var_dimensions, const int dtype, const std::string& pio_decomp_tag, const int nc_dtype, const int deflate_level);
   /* Register a variable with a file.  Called during the file setup, for an input stream. */
   void get_variable(const std::string& filename,const std::string& shortname, const std::string& longname, const int numdims, const char**&& var_dimensions, const int dtype, const std::string& pio_decomp_tag);
   void get_variable(const std::string& filename,const std::string& shortname, const std::string& longname, const int numdims, const std::vector<std::string>& var_dimensions, const int dtype, const std::string& pio_decomp_tag);
@@ -50,6 +57,8 @@ namespace scorpio {
   void eam_pio_enddef(const std::string &filename);
   /* Called each timestep to update the timesnap for the last written output. */
   void pio_update_time(const std::string &filename, const Real time);
+  /* Set the time slice (1-based) read from an input file. By default, the first time slice is read. */
+  void set_read_time_index(const std::string &filename, const int time_index);
 
   /* Read data for a specific variable from a specific file. */
   void grid_read_data_array (const std::string &filename, const std::string &varname, const Int& dim_length, Real* hbuf);
@@ -58,8 +67,25 @@ namespace scorpio {
   void grid_write_data_array(const std::string &filename, const std::string &varname, const Int& dim_length, const Real* hbuf);
   void grid_write_data_array(const std::string &filename, const std::string &varname, const std::vector<int>& dims, const Int& dim_length, const Int& padding, const Real* hbuf);
 
+  /* Get a handle to a variable of a file. The handle can be used in place of the filename/varname pair to read/write,
+   * avoiding the lookup of the file and variable by name at every call. Must be called after eam_pio_enddef, and is
+   * valid until the file is closed. */
+  int get_var_handle(const std::string &filename, const std::string &varname);
+  /* Read/write data for a variable through its handle. dim_length is the length of hbuf, which must match the dofs length. */
+  void grid_read_data_array (const int var_handle, const Int& dim_length, Real* hbuf);
+  void grid_write_data_array(const int var_handle, const Int& dim_length, const Real* hbuf);
+  /* Write the data of the last num_frames time levels of the file (see pio_update_time) with a single, aggregated, write.
+   * hbuf holds the data of each time level, one after the other, and dim_length is the total length of hbuf. */
+  void grid_write_data_array_frames(const int var_handle, const int num_frames, const Int& dim_length, const Real* hbuf);
+
   /* Helper functions */
+  /* Given the dof offsets of a (unpadded) variable, returns the dof offsets of the padded allocation, with -1 for the
+   * padding entries. Setting these dofs lets PIO skip the padding, so padded arrays can be read/written without copies. */
+  std::vector<Int> get_padded_dof_offsets(const std::vector<Int>& var_dof, const int last_dim_len, const int padding);
   void add_remove_padding(const int slow_dim_len, const int pad_dim_len, const int padding, const Real *hbuf_in, Real *hbuf_out, bool add_padding);
+  /* Round each entry of hbuf to the given number of significant decimal digits, by zeroing the trailing bits of its mantissa
+   * (bit-rounding). The result is not more accurate, but compresses much better. NaN and Inf entries are left untouched. */
+  void quantize_significant_digits(Real* hbuf, const Int dim_length, const int significant_digits);
   void count_pio_atm_file();
 
 extern "C" {
@@ -114,6 +140,12 @@ inline std::string get_nc_tag_name (const FieldTag& t, const int extent) {
     case LWBND:
       name = "lwband";
       break;
+    case PLEV:
+      name = "plev";
+      break;
+    case ZLEV:
+      name = "zlev";
+      break;
     default:
       EKAT_ERROR_MSG("Error! Field tag not supported in netcdf files.");
   }
@@ -17,6 +17,12 @@
 #include "share/field/field_manager.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
 namespace {
 using namespace scream;
 using namespace ekat::units;
@@ -30,6 +36,18 @@ std::shared_ptr<UserProvidedGridsManager>   get_test_gm(const ekat::Comm& io_com
 ekat::ParameterList                         get_om_params(const Int casenum, const ekat::Comm& comm);
 ekat::ParameterList                         get_in_params(const std::string type, const ekat::Comm& comm);
 
+// Fields whose values in each column only depend on a given value for that column (e.g., its gid),
+// so that they can be checked after going through files on different grids.
+std::shared_ptr<FieldManager<Real>>      get_col_fm(std::shared_ptr<const AbstractGrid> grid);
+void                                        set_col_values(const std::shared_ptr<FieldManager<Real>>& fm, const std::vector<Real>& col_vals);
+void                                        check_col_values(const std::shared_ptr<FieldManager<Real>>& fm, const std::vector<Real>& col_vals,
+                                                             const std::map<std::string,Real>& rel_tols = {});
+void                                        reset_col_values(const std::shared_ptr<FieldManager<Real>>& fm);
+std::vector<Real>                           get_gids(const AbstractGrid& grid);
+ekat::ParameterList                         get_col_out_params(const std::string& casename, const Int max_steps);
+ekat::ParameterList                         get_col_in_params(const std::string& filename);
+std::string                                 get_col_out_filename(const std::string& casename, const util::TimeStamp& time);
+
 TEST_CASE("input_output_basic","io")
 {
 
@@ -202,6 +220,606 @@ TEST_CASE("input_output_basic","io")
   (*grid_man).clean_up();
 } // TEST_CASE output_instance
 /* ----------------------------------*/
+TEST_CASE("quantize_significant_digits","io")
+{
+  const int n = 1000;
+  std::vector<Real> data(n), orig(n);
+  for (int i=0; i<n; ++i) {
+    // Values of both signs, over many orders of magnitude
+    orig[i] = (i%2==0 ? 1 : -1) * std::pow(10.0,(i%21)-10) * (1 + std::sin(Real(i)));
+  }
+  orig[0] = 0;
+  orig[1] = std::numeric_limits<Real>::max();
+
+  for (int nsd : {1, 3, 5}) {
+    data = orig;
+    scorpio::quantize_significant_digits(data.data(),n,nsd);
+    const Real rel_tol = 0.5*std::pow(10.0,-nsd);
+    for (int i=0; i<n; ++i) {
+      REQUIRE (std::isfinite(data[i]));
+      REQUIRE (std::abs(data[i]-orig[i])<=rel_tol*std::abs(orig[i]));
+    }
+
+    // Rounding twice must not change the values
+    auto twice = data;
+    scorpio::quantize_significant_digits(twice.data(),n,nsd);
+    REQUIRE (twice==data);
+  }
+
+  // Asking for more digits than Real can represent leaves the data untouched
+  data = orig;
+  scorpio::quantize_significant_digits(data.data(),n,std::numeric_limits<Real>::digits10+2);
+  REQUIRE (data==orig);
+}
+/* ----------------------------------*/
+TEST_CASE("output_diagnostics","io")
+{
+  using namespace ShortFieldTagsNames;
+  using FL = FieldLayout;
+  using FR = FieldRequest;
+
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+  const Int num_gcols = 2*io_comm.size();
+  const Int num_levs = 4;
+  auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+  const int num_lcols = grid->get_num_local_dofs();
+  const auto& gn = grid->name();
+
+  auto fm = std::make_shared<FieldManager<Real>>(grid);
+  const FL layout ({COL,LEV},{num_lcols,num_levs});
+  fm->registration_begins();
+  fm->register_field(FR{FieldIdentifier("T_mid",layout,K,gn)});
+  fm->register_field(FR{FieldIdentifier("p_mid",layout,Pa,gn)});
+  fm->register_field(FR{FieldIdentifier("pseudo_density",layout,Pa,gn)});
+  fm->register_field(FR{FieldIdentifier("qc",layout,kg/kg,gn),Pack::n});
+  fm->registration_ends();
+
+  // Fill the inputs
+  auto T  = fm->get_field("T_mid");
+  auto p  = fm->get_field("p_mid");
+  auto dp = fm->get_field("pseudo_density");
+  auto qc = fm->get_field("qc");
+  auto T_h  = T.get_reshaped_view<Real**,Host>();
+  auto p_h  = p.get_reshaped_view<Real**,Host>();
+  auto dp_h = dp.get_reshaped_view<Real**,Host>();
+  auto qc_h = qc.get_reshaped_view<Real**,Host>();
+  for (int icol=0; icol<num_lcols; ++icol) {
+    for (int ilev=0; ilev<num_levs; ++ilev) {
+      T_h(icol,ilev)  = 250 + 10*ilev;
+      p_h(icol,ilev)  = 50000 + 10000*ilev;
+      dp_h(icol,ilev) = 1000*(icol+1);
+      qc_h(icol,ilev) = 1e-4*(ilev+1);
+    }
+  }
+  T.sync_to_dev();
+  p.sync_to_dev();
+  dp.sync_to_dev();
+  qc.sync_to_dev();
+  util::TimeStamp time (0,0,0,0);
+  fm->init_fields_time_stamp(time);
+
+  OutputDiagnostics diags(fm);
+  REQUIRE (diags.is_diagnostic("LiqWaterPath"));
+  REQUIRE (diags.is_diagnostic("potentialtemperature"));
+  REQUIRE (not diags.is_diagnostic("T_mid"));
+
+  // Diagnostics are shared
+  auto lwp = diags.get_diagnostic("LiqWaterPath");
+  REQUIRE (lwp==diags.get_diagnostic("LiqWaterPath"));
+  auto theta = diags.get_diagnostic("PotentialTemperature");
+
+  // Inputs are missing
+  REQUIRE_THROWS (diags.get_diagnostic("IceWaterPath"));
+
+  lwp->compute();
+  theta->compute();
+  const Real g = 9.80616;
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  auto lwp_f   = lwp->get_diagnostic();
+  auto theta_f = theta->get_diagnostic();
+  REQUIRE (lwp_f.get_header().get_tracking().get_time_stamp()==time);
+  lwp_f.sync_to_host();
+  theta_f.sync_to_host();
+  auto lwp_h   = lwp_f.get_view<Host>();
+  auto theta_h = theta_f.get_reshaped_view<Real**,Host>();
+  for (int icol=0; icol<num_lcols; ++icol) {
+    Real expected = 0;
+    for (int ilev=0; ilev<num_levs; ++ilev) {
+      expected += qc_h(icol,ilev)*dp_h(icol,ilev)/g;
+      const Real theta_expected = T_h(icol,ilev)*std::pow(100000/p_h(icol,ilev),287.042/1004.64);
+      REQUIRE (std::abs(theta_h(icol,ilev)-theta_expected)<tol*theta_expected);
+    }
+    REQUIRE (std::abs(lwp_h(icol)-expected)<tol*expected);
+  }
+
+  // If the inputs are not updated, the diagnostic is not recomputed
+  Kokkos::deep_copy(qc.get_view(),0);
+  lwp->compute();
+  lwp_f.sync_to_host();
+  REQUIRE (lwp_h(0)>0);
+
+  // Once the inputs are updated, it is
+  time += 1;
+  qc.get_header().get_tracking().update_time_stamp(time);
+  lwp->compute();
+  lwp_f.sync_to_host();
+  for (int icol=0; icol<num_lcols; ++icol) {
+    REQUIRE (lwp_h(icol)==0);
+  }
+}
+/* ----------------------------------*/
+
+TEST_CASE("output_vertical_remap","io")
+{
+  using namespace ShortFieldTagsNames;
+  using FL = FieldLayout;
+  using FR = FieldRequest;
+
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+  const Int num_gcols = 2*io_comm.size();
+  const Int num_levs = 4;
+  auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+  const int num_lcols = grid->get_num_local_dofs();
+  const auto& gn = grid->name();
+
+  auto fm = std::make_shared<FieldManager<Real>>(grid);
+  const FL layout ({COL,LEV},{num_lcols,num_levs});
+  fm->registration_begins();
+  fm->register_field(FR{FieldIdentifier("p_mid",layout,Pa,gn),Pack::n});
+  fm->register_field(FR{FieldIdentifier("z_mid",layout,m,gn)});
+  fm->register_field(FR{FieldIdentifier("T_mid",layout,K,gn),Pack::n});
+  fm->register_field(FR{FieldIdentifier("ps",FL({COL},{num_lcols}),Pa,gn)});
+  fm->registration_ends();
+
+  // Pressure doubles at each level, and height decreases linearly, so that the
+  // level index is linear in both log(p) and z, and the remap of T_mid=ilev is exact.
+  auto p = fm->get_field("p_mid");
+  auto z = fm->get_field("z_mid");
+  auto T = fm->get_field("T_mid");
+  auto p_h = p.get_reshaped_view<Real**,Host>();
+  auto z_h = z.get_reshaped_view<Real**,Host>();
+  auto T_h = T.get_reshaped_view<Real**,Host>();
+  for (int icol=0; icol<num_lcols; ++icol) {
+    for (int ilev=0; ilev<num_levs; ++ilev) {
+      p_h(icol,ilev) = 10000*std::pow(2.0,ilev);
+      z_h(icol,ilev) = 1000*(num_levs-ilev);
+      T_h(icol,ilev) = ilev;
+    }
+  }
+  p.sync_to_dev();
+  z.sync_to_dev();
+  T.sync_to_dev();
+  util::TimeStamp time (0,0,0,0);
+  fm->init_fields_time_stamp(time);
+
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  auto check_remap = [&](const std::string& coord, const std::vector<double>& levels,
+                         const std::vector<Real>& expected) {
+    ekat::ParameterList params("VERTICAL REMAP");
+    params.set<std::string>("COORDINATE",coord);
+    params.set("LEVELS",levels);
+    OutputVerticalRemap remap(fm,params);
+
+    REQUIRE (remap.can_remap(T));
+    REQUIRE (not remap.can_remap(fm->get_field("ps")));
+
+    auto tgt = remap.create_target_field(T);
+    const auto& tgt_layout = tgt.get_header().get_identifier().get_layout();
+    REQUIRE (tgt_layout.tag(1)==(coord=="Pressure" ? PLEV : ZLEV));
+    REQUIRE (tgt_layout.dim(1)==static_cast<int>(levels.size()));
+
+    remap.remap(T,tgt);
+    REQUIRE (tgt.get_header().get_tracking().get_time_stamp()==time);
+    tgt.sync_to_host();
+    auto tgt_h = tgt.get_reshaped_view<Real**,Host>();
+    for (int icol=0; icol<num_lcols; ++icol) {
+      for (size_t k=0; k<levels.size(); ++k) {
+        REQUIRE (std::abs(tgt_h(icol,k)-expected[k])<tol*num_levs);
+      }
+    }
+  };
+
+  // Above the top, at a model level, between levels, below the surface
+  check_remap("Pressure",{5000,20000,30000,200000},{0,1,static_cast<Real>(std::log2(3.0)),num_levs-1});
+  check_remap("Height",{10000,3000,1500,0},{0,1,2.5,num_levs-1});
+
+  // The coordinate field must be in the field manager
+  ekat::ParameterList params("VERTICAL REMAP");
+  params.set<std::string>("COORDINATE","Pressure");
+  params.set("LEVELS",std::vector<double>{85000});
+  OutputVerticalRemap remap(fm,params);
+  auto T_int = Field<Real>(FieldIdentifier("T_int",FL({COL,ILEV},{num_lcols,num_levs+1}),K,gn));
+  T_int.allocate_view();
+  REQUIRE_THROWS (remap.create_target_field(T_int));
+
+  // Unsupported coordinate
+  params.set<std::string>("COORDINATE","Theta");
+  REQUIRE_THROWS (OutputVerticalRemap(fm,params));
+}
+/* ----------------------------------*/
+
+TEST_CASE("output_columns","io")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  const Int num_gcols = 2*io_comm.size();
+  const Int num_levs = 3;
+  const Int num_steps = 9;
+  const std::string np = "_np" + std::to_string(io_comm.size());
+
+  // 1. Write a subset of the columns, with one column in the file per rank.
+  //    On rank r, column r of the file is the gid gids_cols[r] (gids_latlon[r]) of the full grid.
+  std::vector<Real> gids_cols, gids_latlon;
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+    gm->set_grid(grid);
+    const int num_lcols = grid->get_num_local_dofs();
+    const auto gids = get_gids(*grid);
+
+    // Place the columns along a curve on the sphere
+    AbstractGrid::geo_view_type lat("lat",num_lcols), lon("lon",num_lcols);
+    auto lat_h = Kokkos::create_mirror_view(lat);
+    auto lon_h = Kokkos::create_mirror_view(lon);
+    for (int icol=0; icol<num_lcols; ++icol) {
+      lat_h(icol) = -40 + gids[icol]*80.0/num_gcols;
+      lon_h(icol) = gids[icol]*300.0/num_gcols;
+    }
+    Kokkos::deep_copy(lat,lat_h);
+    Kokkos::deep_copy(lon,lon_h);
+    auto pgrid = std::const_pointer_cast<PointGrid>(grid);
+    pgrid->set_geometry_data("lat",lat);
+    pgrid->set_geometry_data("lon",lon);
+
+    // The odd gids, in reverse order
+    std::vector<int> gids_list;
+    for (int gid=num_gcols-1; gid>=0; gid-=2) {
+      gids_list.push_back(gid);
+      gids_cols.push_back(gid);
+    }
+    // The points closest to the even gids
+    std::vector<double> lats, lons;
+    for (int gid=0; gid<num_gcols; gid+=2) {
+      lats.push_back(-40 + gid*80.0/num_gcols + 0.1);
+      lons.push_back(gid*300.0/num_gcols - 0.1);
+      gids_latlon.push_back(gid);
+    }
+
+    // The buffer of the GIDS stream is written when full (steps 1-4), when the file is full (steps 5-6),
+    // and at finalize (steps 7-9, in a second file).
+    auto cols_params = get_col_out_params("io_columns_gids"+np,6);
+    cols_params.sublist("COLUMNS").set("GIDS",gids_list);
+    cols_params.set<Int>("BUFFER STEPS",4);
+    auto latlon_params = get_col_out_params("io_columns_latlon"+np,num_steps);
+    latlon_params.sublist("COLUMNS").set("LAT",lats);
+    latlon_params.sublist("COLUMNS").set("LON",lons);
+
+    auto fm = get_col_fm(grid);
+    AtmosphereOutput cols_out(io_comm,cols_params,fm,gm);
+    AtmosphereOutput latlon_out(io_comm,latlon_params,fm,gm);
+    cols_out.init();
+    latlon_out.init();
+    util::TimeStamp time (0,0,0,0);
+    for (int step=1; step<=num_steps; ++step) {
+      time += 1;
+      auto vals = gids;
+      for (auto& v : vals) {
+        v += 1000*step;
+      }
+      set_col_values(fm,vals);
+      cols_out.run(time);
+      latlon_out.run(time);
+    }
+    cols_out.finalize();
+    latlon_out.finalize();
+
+    // Too few columns for the IO comm group
+    if (io_comm.size()>1) {
+      auto few_params = get_col_out_params("io_columns_few"+np,1);
+      few_params.sublist("COLUMNS").set("GIDS",std::vector<int>{0});
+      AtmosphereOutput few_out(io_comm,few_params,fm,gm);
+      REQUIRE_THROWS(few_out.init());
+    }
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+
+  // 2. Read back each snap on a grid with one column per rank.
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",io_comm.size(),num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    const int rank = io_comm.rank();
+
+    util::TimeStamp time (0,0,0,0);
+    util::TimeStamp cols_file_time, latlon_file_time;
+    for (int step=1; step<=num_steps; ++step) {
+      time += 1;
+      if (step==1) { latlon_file_time = time; }
+      if (step==1 or step==7) { cols_file_time = time; }
+      const int cols_snap = step<=6 ? step : step-6;
+
+      reset_col_values(fm);
+      auto cols_in_params = get_col_in_params(get_col_out_filename("io_columns_gids"+np,cols_file_time));
+      cols_in_params.set("TIME INDEX",cols_snap);
+      AtmosphereInput cols_in(io_comm,cols_in_params,fm,gm);
+      cols_in.pull_input();
+      check_col_values(fm,{gids_cols[rank] + 1000*step});
+
+      reset_col_values(fm);
+      auto latlon_in_params = get_col_in_params(get_col_out_filename("io_columns_latlon"+np,latlon_file_time));
+      latlon_in_params.set("TIME INDEX",step);
+      AtmosphereInput latlon_in(io_comm,latlon_in_params,fm,gm);
+      latlon_in.pull_input();
+      check_col_values(fm,{gids_latlon[rank] + 1000*step});
+    }
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+}
+/* ----------------------------------*/
+
+TEST_CASE("output_buffered","io")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  const Int num_gcols = 2*io_comm.size();
+  const Int num_levs = 3;
+  const Int num_steps = 7;
+  const std::string np = "_np" + std::to_string(io_comm.size());
+
+  // The buffer is written when full (steps 1-3), when the file is full (steps 4-5),
+  // and at finalize (steps 6-7, in a second file).
+  auto params = get_col_out_params("io_buffered"+np,5);
+  params.set<Int>("BUFFER STEPS",3);
+
+  auto get_vals = [](const std::vector<Real>& gids, const int step) {
+    auto vals = gids;
+    for (auto& v : vals) {
+      v += 1000*step;
+    }
+    return vals;
+  };
+
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    const auto gids = get_gids(*grid);
+
+    AtmosphereOutput out(io_comm,params,fm,gm);
+    out.init();
+    util::TimeStamp time (0,0,0,0);
+    for (int step=1; step<=num_steps; ++step) {
+      time += 1;
+      set_col_values(fm,get_vals(gids,step));
+      out.run(time);
+    }
+    out.finalize();
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+
+  // Read back each snap
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    const auto gids = get_gids(*grid);
+
+    util::TimeStamp time (0,0,0,0);
+    util::TimeStamp file_time;
+    for (int step=1; step<=num_steps; ++step) {
+      time += 1;
+      if (step==1 or step==6) { file_time = time; }
+
+      reset_col_values(fm);
+      auto in_params = get_col_in_params(get_col_out_filename("io_buffered"+np,file_time));
+      in_params.set("TIME INDEX",step<=5 ? step : step-5);
+      AtmosphereInput in(io_comm,in_params,fm,gm);
+      in.pull_input();
+      check_col_values(fm,get_vals(gids,step));
+    }
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+}
+/* ----------------------------------*/
+
+TEST_CASE("output_encodings","io")
+{
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  const Int num_gcols = 2*io_comm.size();
+  const Int num_levs = 3;
+  const std::string np = "_np" + std::to_string(io_comm.size());
+
+  // Each stream writes one snap, with a different encoding
+  const int nsd = 3;
+  auto single_params = get_col_out_params("io_encoding_single"+np,1);
+  single_params.set<std::string>("DATA TYPE","Single");
+  auto digits_params = get_col_out_params("io_encoding_digits"+np,1);
+  digits_params.set<Int>("SIGNIFICANT DIGITS",nsd);
+  digits_params.sublist("FIELD ENCODINGS").sublist("field_3").set<Int>("SIGNIFICANT DIGITS",0);
+  auto deflate_params = get_col_out_params("io_encoding_deflate"+np,1);
+  deflate_params.set<Int>("COMPRESSION LEVEL",1);
+
+  // The fractional parts of the values are not exactly representable in binary
+  auto get_vals = [](const std::vector<Real>& gids) {
+    auto vals = gids;
+    for (auto& v : vals) {
+      v += 1000 + 1.0/3.0;
+    }
+    return vals;
+  };
+
+  util::TimeStamp time (0,0,0,0);
+  time += 1;
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    set_col_values(fm,get_vals(get_gids(*grid)));
+
+    for (const auto& params : {single_params, digits_params, deflate_params}) {
+      AtmosphereOutput out(io_comm,params,fm,gm);
+      out.init();
+      out.run(time);
+      out.finalize();
+    }
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_gcols,num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    const auto vals = get_vals(get_gids(*grid));
+
+    // Single precision: values are within float round-off
+    const Real float_tol = std::numeric_limits<float>::epsilon();
+    reset_col_values(fm);
+    AtmosphereInput single_in(io_comm,get_col_in_params(get_col_out_filename("io_encoding_single"+np,time)),fm,gm);
+    single_in.pull_input();
+    check_col_values(fm,vals,{{"field_1",float_tol},{"field_3",float_tol},{"field_packed",float_tol}});
+
+    // Significant digits: values are rounded, except for field_3, which overrides the stream setting
+    const Real digits_tol = 0.5*std::pow(10.0,-nsd);
+    reset_col_values(fm);
+    AtmosphereInput digits_in(io_comm,get_col_in_params(get_col_out_filename("io_encoding_digits"+np,time)),fm,gm);
+    digits_in.pull_input();
+    check_col_values(fm,vals,{{"field_1",digits_tol},{"field_packed",digits_tol}});
+    auto f1 = fm->get_field("field_1");
+    f1.sync_to_host();
+    auto f1_host = f1.get_view<Host>();
+    for (size_t icol=0; icol<vals.size(); ++icol) {
+      REQUIRE (f1_host(icol)!=vals[icol]);
+    }
+
+    // Compression is lossless
+    reset_col_values(fm);
+    AtmosphereInput deflate_in(io_comm,get_col_in_params(get_col_out_filename("io_encoding_deflate"+np,time)),fm,gm);
+    deflate_in.pull_input();
+    check_col_values(fm,vals);
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+}
+/* ----------------------------------*/
+
+TEST_CASE("ensemble_io","io")
+{
+  // The columns of member m of an ensemble grid are the gids [m*N,(m+1)*N), with N the number of columns of a member.
+  ekat::Comm io_comm(MPI_COMM_WORLD);
+  MPI_Fint fcomm = MPI_Comm_c2f(io_comm.mpi_comm());
+  const Int num_member_cols = 2*io_comm.size();
+  const Int num_members = 3;
+  const Int num_levs = 3;
+  const std::string np = "_np" + std::to_string(io_comm.size());
+  util::TimeStamp time (0,0,0,0);
+  time += 1;
+
+  // Note: the decompositions only depend on the dimension names, so each grid gets its own PIO session.
+  // 1. Write a file with the columns of one member, from a grid without ensemble members.
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_member_cols,num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    set_col_values(fm,get_gids(*grid));
+
+    AtmosphereOutput out(io_comm,get_col_out_params("io_ensemble_member_ic"+np,1),fm,gm);
+    out.init();
+    out.run(time);
+    out.finalize();
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+
+  // 2. On the ensemble grid, write the columns of all members, and of member 1 only,
+  //    then read the file of step 1 with ENSEMBLE INPUT, and the file with all members.
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_member_cols,num_levs,num_members,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    const auto gids = get_gids(*grid);
+    set_col_values(fm,gids);
+
+    AtmosphereOutput all_out(io_comm,get_col_out_params("io_ensemble_all"+np,1),fm,gm);
+    auto member_params = get_col_out_params("io_ensemble_member_1"+np,1);
+    member_params.set<Int>("ENSEMBLE MEMBER",1);
+    AtmosphereOutput member_out(io_comm,member_params,fm,gm);
+    for (auto out : {&all_out,&member_out}) {
+      out->init();
+      out->run(time);
+      out->finalize();
+    }
+
+    // All members read the same columns of the file
+    reset_col_values(fm);
+    auto ic_params = get_col_in_params(get_col_out_filename("io_ensemble_member_ic"+np,time));
+    ic_params.set("ENSEMBLE INPUT",true);
+    AtmosphereInput ic_in(io_comm,ic_params,fm,gm);
+    ic_in.pull_input();
+    std::vector<Real> member_gids(gids.size());
+    for (size_t icol=0; icol<gids.size(); ++icol) {
+      member_gids[icol] = static_cast<int>(gids[icol]) % num_member_cols;
+    }
+    check_col_values(fm,member_gids);
+
+    // A regular read with the same dimensions must not reuse the decomposition of the ensemble input
+    reset_col_values(fm);
+    AtmosphereInput all_in(io_comm,get_col_in_params(get_col_out_filename("io_ensemble_all"+np,time)),fm,gm);
+    all_in.pull_input();
+    check_col_values(fm,gids);
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+
+  // 3. The file of member 1 stores the columns of that member, in order.
+  {
+    scorpio::eam_init_pio_subsystem(fcomm);
+    auto gm = std::make_shared<UserProvidedGridsManager>();
+    auto grid = create_point_grid("Physics",num_member_cols,num_levs,io_comm);
+    gm->set_grid(grid);
+    auto fm = get_col_fm(grid);
+    reset_col_values(fm);
+
+    AtmosphereInput member_in(io_comm,get_col_in_params(get_col_out_filename("io_ensemble_member_1"+np,time)),fm,gm);
+    member_in.pull_input();
+    auto member_gids = get_gids(*grid);
+    for (auto& gid : member_gids) {
+      gid += num_member_cols;
+    }
+    check_col_values(fm,member_gids);
+
+    scorpio::eam_pio_finalize();
+    gm->clean_up();
+  }
+}
+/* ----------------------------------*/
 
 /*===================================================================================================================*/
 std::shared_ptr<FieldManager<Real>> get_test_fm(std::shared_ptr<const AbstractGrid> grid)
@@ -334,4 +952,134 @@ ekat::ParameterList get_in_params(const std::string type, const ekat::Comm& comm
   return in_params;
 }
 /*===================================================================================================================*/
+std::shared_ptr<FieldManager<Real>> get_col_fm(std::shared_ptr<const AbstractGrid> grid)
+{
+  using namespace ShortFieldTagsNames;
+  using FL = FieldLayout;
+  using FR = FieldRequest;
+
+  auto fm = std::make_shared<FieldManager<Real>>(grid);
+
+  const int num_lcols = grid->get_num_local_dofs();
+  const int num_levs = grid->get_num_vertical_levels();
+  const std::string& gn = grid->name();
+
+  fm->registration_begins();
+  fm->register_field(FR{FieldIdentifier("field_1",FL({COL},{num_lcols}),m,gn)});
+  fm->register_field(FR{FieldIdentifier("field_3",FL({COL,LEV},{num_lcols,num_levs}),kg/m,gn)});
+  fm->register_field(FR{FieldIdentifier("field_packed",FL({COL,LEV},{num_lcols,num_levs}),kg/m,gn),Pack::n});
+  fm->registration_ends();
+
+  util::TimeStamp time (0,0,0,0);
+  fm->init_fields_time_stamp(time);
+
+  return fm;
+}
+/*===================================================================================================================*/
+void set_col_values(const std::shared_ptr<FieldManager<Real>>& fm, const std::vector<Real>& col_vals)
+{
+  const int num_levs = fm->get_grid()->get_num_vertical_levels();
+  auto f1 = fm->get_field("field_1");
+  auto f3 = fm->get_field("field_3");
+  auto f4 = fm->get_field("field_packed");
+  auto f1_host = f1.get_view<Host>();
+  auto f3_host = f3.get_reshaped_view<Real**,Host>();
+  auto f4_host = f4.get_reshaped_view<Pack**,Host>();
+  for (size_t ii=0;ii<col_vals.size();++ii) {
+    f1_host(ii) = col_vals[ii];
+    for (int jj=0;jj<num_levs;++jj) {
+      f3_host(ii,jj) = col_vals[ii] + (jj+1)/10.0;
+      f4_host(ii,jj/packsize)[jj%packsize] = col_vals[ii] + (jj+1)/10.0;
+    }
+  }
+  f1.sync_to_dev();
+  f3.sync_to_dev();
+  f4.sync_to_dev();
+}
+/*===================================================================================================================*/
+void check_col_values(const std::shared_ptr<FieldManager<Real>>& fm, const std::vector<Real>& col_vals,
+                      const std::map<std::string,Real>& rel_tols)
+{
+  // Unless the file encoding changes the data (see rel_tols), the values go through files
+  // unchanged, so they can be compared exactly.
+  auto close = [&](const std::string& fname, const Real val, const Real expected) {
+    const auto it = rel_tols.find(fname);
+    return it==rel_tols.end() ? val==expected : std::abs(val-expected)<=it->second*std::abs(expected);
+  };
+  const int num_levs = fm->get_grid()->get_num_vertical_levels();
+  auto f1 = fm->get_field("field_1");
+  auto f3 = fm->get_field("field_3");
+  auto f4 = fm->get_field("field_packed");
+  f1.sync_to_host();
+  f3.sync_to_host();
+  f4.sync_to_host();
+  auto f1_host = f1.get_view<Host>();
+  auto f3_host = f3.get_reshaped_view<Real**,Host>();
+  auto f4_host = f4.get_reshaped_view<Pack**,Host>();
+  REQUIRE(static_cast<int>(col_vals.size())==fm->get_grid()->get_num_local_dofs());
+  for (size_t ii=0;ii<col_vals.size();++ii) {
+    REQUIRE(close("field_1",f1_host(ii),col_vals[ii]));
+    for (int jj=0;jj<num_levs;++jj) {
+      const Real expected = col_vals[ii] + (jj+1)/10.0;
+      REQUIRE(close("field_3",f3_host(ii,jj),expected));
+      REQUIRE(close("field_packed",f4_host(ii,jj/packsize)[jj%packsize],expected));
+    }
+  }
+}
+/*===================================================================================================================*/
+void reset_col_values(const std::shared_ptr<FieldManager<Real>>& fm)
+{
+  // Set all values to nan, to ensure no false-positive tests if a field is simply not read.
+  for (const std::string fname : {"field_1","field_3","field_packed"}) {
+    Kokkos::deep_copy(fm->get_field(fname).get_view(),std::nan(""));
+  }
+}
+/*===================================================================================================================*/
+std::vector<Real> get_gids(const AbstractGrid& grid)
+{
+  auto gids_host = Kokkos::create_mirror_view(grid.get_dofs_gids());
+  Kokkos::deep_copy(gids_host,grid.get_dofs_gids());
+  return std::vector<Real>(gids_host.data(),gids_host.data()+gids_host.size());
+}
+/*===================================================================================================================*/
+ekat::ParameterList get_col_out_params(const std::string& casename, const Int max_steps)
+{
+  ekat::ParameterList out_params("Output Parameters");
+  out_params.set<std::string>("FILENAME",casename);
+  out_params.set<std::string>("AVERAGING TYPE","Instant");
+  out_params.set<std::string>("GRID","Physics");
+  auto& freq_params = out_params.sublist("FREQUENCY");
+  freq_params.set<Int>("OUT_N",1);
+  freq_params.set<std::string>("OUT_OPTION","Steps");
+  freq_params.set<Int>("OUT_MAX_STEPS",max_steps);
+  auto& f_list = out_params.sublist("FIELDS");
+  f_list.set<Int>("Number of Fields",3);
+  f_list.set<std::string>("field 1","field_1");
+  f_list.set<std::string>("field 2","field_3");
+  f_list.set<std::string>("field 3","field_packed");
+  return out_params;
+}
+/*===================================================================================================================*/
+ekat::ParameterList get_col_in_params(const std::string& filename)
+{
+  ekat::ParameterList in_params("Input Parameters");
+  in_params.set<std::string>("FILENAME",filename);
+  in_params.set<std::string>("GRID","Physics");
+  auto& f_list = in_params.sublist("FIELDS");
+  f_list.set<Int>("Number of Fields",3);
+  f_list.set<std::string>("field 1","field_1");
+  f_list.set<std::string>("field 2","field_3");
+  f_list.set<std::string>("field 3","field_packed");
+  return in_params;
+}
+/*===================================================================================================================*/
+std::string get_col_out_filename(const std::string& casename, const util::TimeStamp& time)
+{
+  // The name of the file opened at the given time by an output stream with the parameters of get_col_out_params
+  std::string time_str = time.to_string();
+  std::replace(time_str.begin(),time_str.end(),' ','.');
+  time_str.erase(std::remove(time_str.begin(),time_str.end(),':'),time_str.end());
+  return casename + ".Instant.Steps_x1." + time_str + ".nc";
+}
+/*===================================================================================================================*/
 } // undefined namespace
@@ -3,11 +3,13 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
+#include "share/atm_process/conservation_check.hpp"
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/grid/user_provided_grids_manager.hpp"
 #include "share/grid/remap/inverse_remapper.hpp"
 #include "share/tests/dummy_se_point_remapper.hpp"
+#include "physics/share/physics_constants.hpp"
 
 #include "ekat/ekat_parse_yaml_file.hpp"
 
@@ -134,6 +136,169 @@ public:
   }
 };
 
+// A physics process that stores its fields, to modify them in run_impl
+class MyMoistPhysics : public DummyProcess<AtmosphereProcessType::Physics>
+{
+public:
+  using base = DummyProcess<AtmosphereProcessType::Physics>;
+
+  MyMoistPhysics (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : base(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto phys_lt = grid->get_3d_scalar_layout (true);
+    m_num_cols = grid->get_num_local_dofs();
+    m_num_levs = grid->get_num_vertical_levels();
+
+    add_field<Required>("pseudo_density",phys_lt,Pa,m_grid_name);
+    add_field<Updated>("T_mid",phys_lt,K,m_grid_name);
+    add_field<Updated>("qv",phys_lt,kg/kg,m_grid_name);
+    add_field<Updated>("qc",phys_lt,kg/kg,m_grid_name);
+  }
+
+protected:
+  void set_required_field_impl (const Field<const Real>& /* f */) {}
+  void set_computed_field_impl (const Field<      Real>& f) {
+    m_fields.emplace(f.get_header().get_identifier().name(),f);
+  }
+
+  std::map<std::string,Field<Real>> m_fields;
+  int m_num_cols;
+  int m_num_levs;
+};
+
+// Condenses 10% of the vapor, heating the air accordingly: conserves water and energy
+class MyCondensation : public MyMoistPhysics
+{
+public:
+  using MyMoistPhysics::MyMoistPhysics;
+
+protected:
+  void run_impl (const Real /* dt */) {
+    using C = physics::Constants<Real>;
+    auto T  = m_fields.at("T_mid");
+    auto qv = m_fields.at("qv");
+    auto qc = m_fields.at("qc");
+    T.sync_to_host();
+    qv.sync_to_host();
+    qc.sync_to_host();
+    auto T_h  = T.get_reshaped_view<Real**,Host>();
+    auto qv_h = qv.get_reshaped_view<Real**,Host>();
+    auto qc_h = qc.get_reshaped_view<Real**,Host>();
+    for (int icol=0; icol<m_num_cols; ++icol) {
+      for (int ilev=0; ilev<m_num_levs; ++ilev) {
+        const Real dq = 0.1*qv_h(icol,ilev);
+        qv_h(icol,ilev) -= dq;
+        qc_h(icol,ilev) += dq;
+        T_h(icol,ilev)  += C::LatVap/C::Cpair*dq;
+      }
+    }
+    T.sync_to_dev();
+    qv.sync_to_dev();
+    qc.sync_to_dev();
+  }
+};
+
+// Removes half of the vapor, with no boundary flux
+class MyLeak : public MyMoistPhysics
+{
+public:
+  using MyMoistPhysics::MyMoistPhysics;
+
+protected:
+  void run_impl (const Real /* dt */) {
+    auto qv = m_fields.at("qv");
+    qv.sync_to_host();
+    auto qv_h = qv.get_reshaped_view<Real**,Host>();
+    for (int icol=0; icol<m_num_cols; ++icol) {
+      for (int ilev=0; ilev<m_num_levs; ++ilev) {
+        qv_h(icol,ilev) *= 0.5;
+      }
+    }
+    qv.sync_to_dev();
+  }
+};
+
+// Rains out all the cloud liquid, deposits 10% of the vapor as ice that falls out too,
+// and adds the surface fluxes to the lowest level: conserves water and energy, given the
+// surface and precipitation fluxes.
+class MySurfacePrecip : public MyMoistPhysics
+{
+public:
+  using MyMoistPhysics::MyMoistPhysics;
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    MyMoistPhysics::set_grids(gm);
+    const auto lt = gm->get_grid(m_grid_name)->get_2d_scalar_layout();
+    add_field<Required>("surf_sens_flux",lt,W/(m*m),m_grid_name);
+    add_field<Required>("surf_latent_flux",lt,W/(m*m),m_grid_name);
+    add_field<Computed>("precip_liq_surf",lt,m/s,m_grid_name);
+    add_field<Computed>("precip_ice_surf",lt,m/s,m_grid_name);
+  }
+
+protected:
+  void set_required_field_impl (const Field<const Real>& f) {
+    m_required.emplace(f.get_header().get_identifier().name(),f);
+  }
+
+  void run_impl (const Real dt) {
+    using C = physics::Constants<Real>;
+    for (const auto& it : m_required) {
+      it.second.sync_to_host();
+    }
+    const auto dp = m_required.at("pseudo_density").get_reshaped_view<const Real**,Host>();
+    const auto shf = m_required.at("surf_sens_flux").get_view<Host>();
+    const auto lhf = m_required.at("surf_latent_flux").get_view<Host>();
+    auto T  = m_fields.at("T_mid");
+    auto qv = m_fields.at("qv");
+    auto qc = m_fields.at("qc");
+    auto liq = m_fields.at("precip_liq_surf");
+    auto ice = m_fields.at("precip_ice_surf");
+    T.sync_to_host();
+    qv.sync_to_host();
+    qc.sync_to_host();
+    auto T_h   = T.get_reshaped_view<Real**,Host>();
+    auto qv_h  = qv.get_reshaped_view<Real**,Host>();
+    auto qc_h  = qc.get_reshaped_view<Real**,Host>();
+    auto liq_h = liq.get_view<Host>();
+    auto ice_h = ice.get_view<Host>();
+    for (int icol=0; icol<m_num_cols; ++icol) {
+      Real liq_mass = 0;
+      Real ice_mass = 0;
+      for (int ilev=0; ilev<m_num_levs; ++ilev) {
+        const Real dq = 0.1*qv_h(icol,ilev);
+        qv_h(icol,ilev) -= dq;
+        T_h(icol,ilev)  += (C::LatVap+C::LatIce)/C::Cpair*dq;
+        ice_mass += dq*dp(icol,ilev)/C::gravit;
+        liq_mass += qc_h(icol,ilev)*dp(icol,ilev)/C::gravit;
+        qc_h(icol,ilev)  = 0;
+      }
+      liq_h(icol) = liq_mass/(C::RHO_H2O*dt);
+      ice_h(icol) = ice_mass/(C::RHO_H2O*dt);
+
+      // The surface water flux is a mass flux
+      const int k = m_num_levs-1;
+      qv_h(icol,k) += lhf(icol)*dt*C::gravit/dp(icol,k);
+      T_h(icol,k)  += shf(icol)*dt*C::gravit/(C::Cpair*dp(icol,k));
+    }
+    T.sync_to_dev();
+    qv.sync_to_dev();
+    qc.sync_to_dev();
+    liq.sync_to_dev();
+    ice.sync_to_dev();
+  }
+
+  std::map<std::string,Field<const Real>> m_required;
+};
+
 std::shared_ptr<UserProvidedGridsManager>
 setup_upgm (const int ne) {
 
@@ -291,4 +456,112 @@ TEST_CASE("atm_proc_dag", "") {
   }
 }
 
+TEST_CASE("conservation_check", "") {
+  using namespace scream;
+  using C = physics::Constants<Real>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A physics grid
+  const int num_levs = 8;
+  auto grid = create_point_grid("Physics",3*comm.size(),num_levs,comm);
+  auto upgm = std::make_shared<UserProvidedGridsManager>();
+  upgm->set_grid(grid);
+  upgm->set_reference_grid(grid->name());
+
+  // Create the processes
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set("Number of Entries",3);
+  params.set<std::string>("Schedule Type","Sequential");
+  auto& p0 = params.sublist("Process 0");
+  p0.set<std::string>("Process Name", "MyCondensation");
+  p0.set<std::string>("Grid Name", "Physics");
+  auto& p1 = params.sublist("Process 1");
+  p1.set<std::string>("Process Name", "MyLeak");
+  p1.set<std::string>("Grid Name", "Physics");
+  auto& p2 = params.sublist("Process 2");
+  p2.set<std::string>("Process Name", "MySurfacePrecip");
+  p2.set<std::string>("Grid Name", "Physics");
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("MyCondensation",&create_atmosphere_process<MyCondensation>);
+  factory.register_product("MyLeak",&create_atmosphere_process<MyLeak>);
+  factory.register_product("MySurfacePrecip",&create_atmosphere_process<MySurfacePrecip>);
+  factory.register_product("grouP",&create_atmosphere_process<AtmosphereProcessGroup>);
+  auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+  group->set_grids(upgm);
+
+  // Create the fields, and hand them to the processes
+  auto fm = std::make_shared<FieldManager<Real>>(grid);
+  fm->registration_begins();
+  for (const auto& req : group->get_required_fields()) {
+    fm->register_field(req);
+  }
+  for (const auto& req : group->get_computed_fields()) {
+    fm->register_field(req);
+  }
+  fm->registration_ends();
+  for (const auto& req : group->get_required_fields()) {
+    group->set_required_field(fm->get_field(req.fid).get_const());
+  }
+  for (const auto& req : group->get_computed_fields()) {
+    group->set_computed_field(fm->get_field(req.fid));
+  }
+
+  // Uniform initial state
+  const Real dp0 = 1000;
+  const Real qv0 = 0.01;
+  fm->get_field("pseudo_density").deep_copy(dp0);
+  fm->get_field("T_mid").deep_copy(300);
+  fm->get_field("qv").deep_copy(qv0);
+  fm->get_field("qc").deep_copy(0);
+  fm->get_field("surf_sens_flux").deep_copy(20);
+  fm->get_field("surf_latent_flux").deep_copy(4e-5);
+
+  util::TimeStamp t0 (0,0,0,0);
+  group->initialize(t0);
+
+  // Check every other step
+  ekat::ParameterList cc_params ("Conservation Check");
+  cc_params.set("Frequency",2);
+  auto cc = std::make_shared<ConservationCheck>(comm,fm,cc_params);
+  group->set_conservation_check(cc);
+
+  const Real dt = 300;
+  cc->begin_step();
+  REQUIRE (cc->is_check_step());
+  group->run(dt);
+  cc->end_step();
+
+  const auto& imbalances = cc->get_imbalances();
+  REQUIRE (imbalances.size()==3);
+  REQUIRE (imbalances[0].name=="MyCondensation");
+  REQUIRE (imbalances[1].name=="MyLeak");
+  REQUIRE (imbalances[2].name=="MySurfacePrecip");
+
+  // Condensation conserves water and energy, up to roundoff
+  const Real water_tot  = qv0*dp0/C::gravit*num_levs;
+  const Real energy_tot = (C::Cpair*300 + (C::LatVap+C::LatIce)*qv0)*dp0/C::gravit*num_levs;
+  REQUIRE (std::abs(imbalances[0].water*dt)<1e-5*water_tot);
+  REQUIRE (std::abs(imbalances[0].energy*dt)<1e-5*energy_tot);
+
+  // The leak removes half of the remaining vapor, with its energy
+  const Real dw = 0.5*0.9*qv0*dp0/C::gravit*num_levs;
+  REQUIRE (std::abs(imbalances[1].water*dt+dw)<1e-5*dw);
+  REQUIRE (std::abs(imbalances[1].energy*dt+(C::LatVap+C::LatIce)*dw)<1e-5*(C::LatVap+C::LatIce)*dw);
+
+  // Precipitation and surface fluxes are accounted for: only roundoff is left
+  REQUIRE (std::abs(imbalances[2].water*dt)<1e-5*water_tot);
+  REQUIRE (std::abs(imbalances[2].energy*dt)<1e-5*energy_tot);
+
+  // The next step is not a check step
+  cc->begin_step();
+  REQUIRE (not cc->is_check_step());
+  group->run(dt);
+  cc->end_step();
+  REQUIRE (cc->get_imbalances().size()==3);
+
+  upgm->clean_up();
+}
+
 } // empty namespace
@@ -426,6 +426,46 @@ TEST_CASE("column_ops_ps_1") {
       REQUIRE (v_int_h(0,k_bwd)[0] == s0+k*(k+1)/2.0);
     }
   }
+
+  SECTION ("interpolate") {
+    using view_1d_type = KT::view_1d<Real>;
+
+    // Source coordinate decreasing with k (like height), and y linear in it,
+    // so that interpolation is exact inside the column.
+    constexpr int num_tgt = 5;
+    view_1d_type z_tgt("",num_tgt);
+    view_1d_type y_tgt("",num_tgt);
+    auto z_tgt_h = Kokkos::create_mirror_view(z_tgt);
+    auto y_tgt_h = Kokkos::create_mirror_view(y_tgt);
+    // Above the top, at a source level, between levels, near the surface, below the surface
+    z_tgt_h(0) = 100.0;
+    z_tgt_h(1) = 10.0;
+    z_tgt_h(2) = 3.25;
+    z_tgt_h(3) = 1.5;
+    z_tgt_h(4) = -2.0;
+    Kokkos::deep_copy(z_tgt,z_tgt_h);
+
+    Kokkos::parallel_for(policy,
+                         KOKKOS_LAMBDA(const member_type& team){
+      auto z_src = [&](const int k)->Real {
+        return num_levs-k;
+      };
+      auto y_src = [&](const int k)->Real {
+        return 2*(num_levs-k)+1;
+      };
+
+      column_ops::compute_interpolated_values(team,num_levs,z_src,y_src,num_tgt,z_tgt,y_tgt);
+    });
+    Kokkos::fence();
+
+    // Check answer
+    Kokkos::deep_copy(y_tgt_h,y_tgt);
+    REQUIRE (y_tgt_h(0) == 2*num_levs+1);
+    REQUIRE (y_tgt_h(1) == 21.0);
+    REQUIRE (y_tgt_h(2) == 7.5);
+    REQUIRE (y_tgt_h(3) == 4.0);
+    REQUIRE (y_tgt_h(4) == 3.0);
+  }
 }
 
 TEST_CASE("column_ops_ps_N") {
@@ -39,6 +39,35 @@ TEST_CASE("point_grid", "") {
   REQUIRE(layout.tag(0) == COL);
 }
 
+TEST_CASE("point_grid_ensemble", "") {
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  int num_procs = comm.size();
+
+  const int num_member_cols = 3*num_procs, num_levels = 72, num_members = 4;
+
+  auto grid = create_point_grid("my_grid", num_member_cols, num_levels, num_members, comm);
+  REQUIRE(grid->get_num_ensemble_members() == num_members);
+  REQUIRE(grid->get_num_global_dofs() == num_members*num_member_cols);
+  REQUIRE(grid->get_num_local_dofs() == 3*num_members);
+
+  // The columns of each member are stacked
+  auto gids = grid->get_dofs_gids();
+  auto host_gids = Kokkos::create_mirror_view(gids);
+  Kokkos::deep_copy(host_gids, gids);
+  auto member = grid->get_geometry_data("ensemble_member");
+  auto host_member = Kokkos::create_mirror_view(member);
+  Kokkos::deep_copy(host_member, member);
+  for (int i = 0; i < grid->get_num_local_dofs(); ++i) {
+    REQUIRE(host_member(i) == host_gids(i) / num_member_cols);
+  }
+
+  // A regular point grid has only one member
+  auto single = create_point_grid("my_grid", num_member_cols, num_levels, comm);
+  REQUIRE(single->get_num_ensemble_members() == 1);
+  REQUIRE(not single->has_geometry_data("ensemble_member"));
+}
+
 TEST_CASE("se_grid", "") {
 
   // Make the grid and check its initial state.
@@ -1,6 +1,9 @@
 #include <catch2/catch.hpp>
 
 #include "share/util//scream_utils.hpp"
+#include "share/util/scream_team_size_tuner.hpp"
+
+#include <cstdio>
 
 TEST_CASE("field_layout") {
   using namespace scream;
@@ -38,3 +41,68 @@ TEST_CASE("field_layout") {
   REQUIRE ( (superset2==tgt || superset2==tgt_rev) );
   REQUIRE ( (superset3==tgt || superset3==tgt_rev) );
 }
+
+TEST_CASE("team_size_tuner") {
+  using namespace scream::util;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const std::string cache_file = "team_size_tuner_cache.txt";
+  std::remove(cache_file.c_str());
+
+  // Tuning is disabled, but there is no cache entry to use
+  REQUIRE_THROWS (TeamSizeTuner("kernel_a", {0,2,4}, cache_file, comm, true));
+
+  // No cache entry: all candidates are timed, and the fastest is selected
+  {
+    TeamSizeTuner tuner("kernel_a", {0,2,4}, cache_file, comm);
+    REQUIRE (tuner.is_tuning());
+
+    // The first run is a warm up, and its time is discarded
+    REQUIRE (tuner.team_size()==tuner.candidates()[0]);
+    tuner.record(0.5);
+    REQUIRE (tuner.is_tuning());
+
+    const double times[3] = {3.0, 1.0, 2.0};
+    for (int i=0; i<3; ++i) {
+      REQUIRE (tuner.team_size()==tuner.candidates()[i]);
+      tuner.record(times[i]);
+    }
+    REQUIRE (not tuner.is_tuning());
+    REQUIRE (tuner.team_size()==2);
+
+    // Further records do not change the selection
+    tuner.record(0.0);
+    REQUIRE (tuner.team_size()==2);
+  }
+
+  // A second kernel is added to the same cache file
+  {
+    TeamSizeTuner tuner("kernel_b", {1,8}, cache_file, comm);
+    tuner.record(0.5);
+    tuner.record(2.0);
+    tuner.record(1.0);
+    REQUIRE (tuner.team_size()==8);
+  }
+
+  // Cached entries are used right away, without tuning
+  {
+    TeamSizeTuner tuner_a("kernel_a", {0,2,4}, cache_file, comm);
+    TeamSizeTuner tuner_b("kernel_b", {1,8}, cache_file, comm, true);
+    REQUIRE (not tuner_a.is_tuning());
+    REQUIRE (not tuner_b.is_tuning());
+    REQUIRE (tuner_a.team_size()==2);
+    REQUIRE (tuner_b.team_size()==8);
+    REQUIRE (tuner_a.candidates().size()==1);
+  }
+
+  // Keys cannot contain spaces, since they are stored in a plain text file
+  REQUIRE_THROWS (TeamSizeTuner("kernel a", {0,2}, cache_file, comm));
+
+  // A tuner with a single candidate does no tuning
+  TeamSizeTuner fixed(16);
+  REQUIRE (not fixed.is_tuning());
+  REQUIRE (fixed.team_size()==16);
+
+  std::remove(cache_file.c_str());
+}
@@ -225,6 +225,61 @@ public:
     column_scan_impl<FromTop>(team,num_mid_levels,dx_m,x_i,s0);
   }
 
+  // Interpolate Y, given at the source coordinates x_src, to the target coordinates x_tgt,
+  // linearly in the coordinate. The source coordinate must be monotone along the column,
+  // but can be either increasing (e.g., pressure) or decreasing (e.g., height) with k.
+  // Notes:
+  //  - target coordinates outside the range of x_src get the value of Y at the closest
+  //    end of the column (i.e., Y is extended as a constant above the top and below the surface).
+  //  - to interpolate linearly in some function of the coordinate (e.g., log(p)),
+  //    use lambdas returning f(x) as coordinate providers.
+  //  - unlike the methods above, this method works on scalars: it is meant for
+  //    post-processing (e.g., output), where the target levels are not padded.
+  template<typename SrcCoordProvider, typename InputProvider, typename TgtCoordProvider, typename MT>
+  KOKKOS_INLINE_FUNCTION
+  static void
+  compute_interpolated_values (const TeamMember& team,
+                               const int num_src_levels,
+                               const SrcCoordProvider& x_src,
+                               const InputProvider& y_src,
+                               const int num_tgt_levels,
+                               const TgtCoordProvider& x_tgt,
+                               const view_1d<scalar_type,MT>& y_tgt)
+  {
+    // Sanity checks
+    EKAT_KERNEL_ASSERT_MSG (num_src_levels>0,
+        "Error! Cannot interpolate from an empty column.\n");
+    EKAT_KERNEL_ASSERT_MSG (num_tgt_levels>=0 && y_tgt.extent_int(0)>=num_tgt_levels,
+        "Error! Number of target levels out of bounds.\n");
+
+    // Flip the sign of the coordinates if needed, so that we work with an increasing coordinate.
+    const int last = num_src_levels-1;
+    const scalar_type sign = x_src(last)>=x_src(0) ? one() : -one();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,num_tgt_levels),
+                         [&](const int k) {
+      const scalar_type x = sign*x_tgt(k);
+      if (x<=sign*x_src(0)) {
+        y_tgt(k) = y_src(0);
+      } else if (x>=sign*x_src(last)) {
+        y_tgt(k) = y_src(last);
+      } else {
+        // Bisection, to find the source layer [lo,hi] containing x
+        int lo = 0;
+        int hi = last;
+        while (hi-lo>1) {
+          const int mid = (lo+hi)/2;
+          if (sign*x_src(mid)<=x) {
+            lo = mid;
+          } else {
+            hi = mid;
+          }
+        }
+        const scalar_type w = (x-sign*x_src(lo)) / (sign*(x_src(hi)-x_src(lo)));
+        y_tgt(k) = y_src(lo) + w*(y_src(hi)-y_src(lo));
+      }
+    });
+  }
+
 protected:
 
   // ------------ Impls of midpoint_value ------------- //
@@ -0,0 +1,128 @@
+#include "share/util/scream_team_size_tuner.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <map>
+
+namespace scream {
+namespace util {
+
+namespace {
+
+// The cache file contains one entry per line, in the form "key team_size"
+std::map<std::string,int> read_cache (const std::string& cache_file)
+{
+  std::map<std::string,int> entries;
+  std::ifstream ifs(cache_file);
+  std::string line;
+  while (std::getline(ifs,line)) {
+    std::istringstream iss(line);
+    std::string key;
+    int team_size;
+    if (iss >> key >> team_size) {
+      entries[key] = team_size;
+    }
+  }
+  return entries;
+}
+
+} // anonymous namespace
+
+TeamSizeTuner::TeamSizeTuner (const int team_size)
+ : m_write_cache (false)
+ , m_candidates  (1,team_size)
+ , m_best        (0)
+ , m_warmed_up   (true)
+{
+  // Nothing else to do
+}
+
+TeamSizeTuner::TeamSizeTuner (const std::string& key,
+                              const std::vector<int>& candidates,
+                              const std::string& cache_file,
+                              const ekat::Comm& comm,
+                              const bool cache_only)
+ : m_key         (key)
+ , m_cache_file  (cache_file)
+ , m_write_cache (comm.am_i_root() && cache_file!="")
+ , m_candidates  (candidates)
+ , m_best        (-1)
+ , m_warmed_up   (false)
+{
+  EKAT_REQUIRE_MSG (m_candidates.size()>0,
+      "Error! TeamSizeTuner needs at least one candidate team size.\n");
+  EKAT_REQUIRE_MSG (m_key.find_first_of(" \t\n")==std::string::npos,
+      "Error! TeamSizeTuner keys cannot contain white spaces.\n"
+      "       key: " + m_key + "\n");
+  EKAT_REQUIRE_MSG (not cache_only || m_cache_file!="",
+      "Error! TeamSizeTuner needs a cache file when tuning is disabled.\n");
+
+  // Only the root rank reads the cache, so that all ranks see the same entry,
+  // regardless of whether (and when) the file is visible to them.
+  int cached = -1;
+  if (m_cache_file!="" && comm.am_i_root()) {
+    const auto entries = read_cache(m_cache_file);
+    auto it = entries.find(m_key);
+    if (it!=entries.end()) {
+      cached = it->second;
+    }
+  }
+  MPI_Bcast(&cached, 1, MPI_INT, 0, comm.mpi_comm());
+
+  EKAT_REQUIRE_MSG (not cache_only || cached>=0,
+      "Error! Team size tuning is disabled, but the key was not found in the cache file.\n"
+      "       key: " + m_key + "\n"
+      "       cache file: " + m_cache_file + "\n");
+
+  if (cached>=0) {
+    // A previous run already tuned this kernel; only the cached value is needed.
+    m_candidates.assign(1,cached);
+    m_write_cache = false;
+  }
+
+  if (m_candidates.size()==1) {
+    m_best = 0;
+  }
+}
+
+int TeamSizeTuner::team_size () const {
+  return is_tuning() ? m_candidates[m_times.size()] : m_candidates[m_best];
+}
+
+void TeamSizeTuner::record (const double elapsed) {
+  if (not is_tuning()) {
+    return;
+  }
+
+  // The first run also includes one-time costs, so it is not used for timing
+  if (not m_warmed_up) {
+    m_warmed_up = true;
+    return;
+  }
+
+  m_times.push_back(elapsed);
+  if (not is_tuning()) {
+    m_best = std::min_element(m_times.begin(),m_times.end()) - m_times.begin();
+    if (m_write_cache) {
+      save_cache();
+    }
+  }
+}
+
+void TeamSizeTuner::save_cache () const {
+  // Re-read the file, in case other kernels were added to it in the meantime
+  auto entries = read_cache(m_cache_file);
+  entries[m_key] = m_candidates[m_best];
+
+  std::ofstream ofs(m_cache_file);
+  EKAT_REQUIRE_MSG (ofs.good(),
+      "Error! Could not open team size tuning cache file '" + m_cache_file + "' for writing.\n");
+  for (const auto& it : entries) {
+    ofs << it.first << " " << it.second << "\n";
+  }
+}
+
+} // namespace util
+} // namespace scream
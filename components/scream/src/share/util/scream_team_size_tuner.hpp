@@ -0,0 +1,137 @@
+#ifndef SCREAM_TEAM_SIZE_TUNER_HPP
+#define SCREAM_TEAM_SIZE_TUNER_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_types.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace scream {
+namespace util {
+
+/*
+ * Runtime selection of the team size of a team-policy kernel.
+ *
+ * The tuner is meant to be used during the first steps of a run: the caller
+ * runs the kernel with team_size(), and reports the elapsed time via record().
+ * The first call to record() is discarded, since the first run of a kernel
+ * also pays for one-time costs (first touch, JIT, cache warm up). After that,
+ * each call to record() moves to the next candidate, until all candidates
+ * have been timed. At that point, the fastest candidate is selected, and
+ * (if a cache file was given) saved in the cache file.
+ *
+ * Entries of the cache file are keyed by a string, which should identify the
+ * kernel, the machine, and the problem size (see make_key). If the cache file
+ * already contains the key, the cached team size is used, and no timing
+ * is performed. The cache file is only accessed by the root rank of the
+ * given comm, and the cached value is broadcast to the other ranks, so that
+ * all ranks agree on whether tuning happens. Callers must still reduce the
+ * timings across ranks before calling record(), so that all ranks select the
+ * same candidate.
+ *
+ * Note: results are NOT reproducible across team sizes. Kernels with team
+ * reductions (e.g., parallel_reduce over a TeamThreadRange) sum in an order
+ * that depends on the team size, so changing the team size changes the
+ * answer at round-off level. While tuning, each of the first steps uses a
+ * different team size, so a tuning run is not BFB with any other run.
+ * Runs that must be BFB (e.g., baseline tests) should either not tune, or
+ * use cache_only, so that a team size tuned by a previous run is pinned.
+ */
+
+class TeamSizeTuner {
+public:
+
+  // A tuner with a single candidate, which does no tuning.
+  explicit TeamSizeTuner (const int team_size = 0);
+
+  // A tuner choosing among the given candidates. If cache_file is not empty,
+  // cached results are loaded from it (on the root rank of comm), and the
+  // selected team size is saved in it once tuning is done (by the root rank).
+  // If cache_only is true, no tuning is performed: the key must be found in
+  // the cache file, and the cached team size is used.
+  TeamSizeTuner (const std::string& key,
+                 const std::vector<int>& candidates,
+                 const std::string& cache_file,
+                 const ekat::Comm& comm,
+                 const bool cache_only = false);
+
+  // Build a cache key from the kernel name, the execution space, and the problem size.
+  template<typename ExeSpace>
+  static std::string make_key (const std::string& kernel_name,
+                               const int ncols, const int nlevs);
+
+  // Whether candidates are still being timed
+  bool is_tuning () const { return m_times.size()<m_candidates.size() && m_candidates.size()>1; }
+
+  // The team size to use for the next run of the kernel
+  int team_size () const;
+
+  // All the team sizes that may be returned by team_size()
+  const std::vector<int>& candidates () const { return m_candidates; }
+
+  // Record the time spent in the kernel when run with team_size().
+  // The first record is discarded (warm up). Does nothing if tuning is done.
+  void record (const double elapsed);
+
+protected:
+
+  void save_cache () const;
+
+  std::string         m_key;
+  std::string         m_cache_file;
+  bool                m_write_cache;
+  std::vector<int>    m_candidates;
+  std::vector<double> m_times;
+  int                 m_best;
+  bool                m_warmed_up;
+};
+
+// Candidate team sizes for a kernel with one team per column, and npacks
+// packs per column: the default policy (team size 0), plus powers of 2 that
+// fit the execution space. On GPU, teams much larger than the number of packs
+// would leave threads idle, so they are not considered.
+template<typename ExeSpace>
+std::vector<int> team_size_candidates (const int npacks)
+{
+  constexpr bool on_gpu = ekat::OnGpu<ExeSpace>::value;
+  const int min_size = on_gpu ? 32 : 1;
+  const int max_size = on_gpu ? std::min(512,2*npacks) : std::min(16,ExeSpace::concurrency());
+
+  std::vector<int> candidates (1,0);
+  for (int ts=min_size; ts<=max_size; ts*=2) {
+    candidates.push_back(ts);
+  }
+  return candidates;
+}
+
+// Build a team policy for ncols columns and the given team size. A team size
+// of 0 gives the default policy.
+template<typename ExeSpace>
+Kokkos::TeamPolicy<ExeSpace>
+make_team_policy (const int ncols, const int npacks, const int team_size, const int vector_size = 1)
+{
+  if (team_size>0) {
+    return Kokkos::TeamPolicy<ExeSpace>(ncols, team_size, vector_size);
+  }
+  return ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, npacks);
+}
+
+template<typename ExeSpace>
+std::string TeamSizeTuner::make_key (const std::string& kernel_name,
+                                     const int ncols, const int nlevs)
+{
+  return kernel_name + ":" + ExeSpace::name() +
+         ":concurrency=" + std::to_string(ExeSpace::concurrency()) +
+         ":ncols=" + std::to_string(ncols) +
+         ":nlevs=" + std::to_string(nlevs);
+}
+
+} // namespace util
+} // namespace scream
+
+#endif // SCREAM_TEAM_SIZE_TUNER_HPP
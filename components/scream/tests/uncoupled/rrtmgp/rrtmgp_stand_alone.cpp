@@ -62,8 +62,9 @@ namespace scream {
         real2d lw_flux_dn_ref;
         rrtmgpTest::read_fluxes(baseline, sw_flux_up_ref, sw_flux_dn_ref, sw_flux_dn_dir_ref, lw_flux_up_ref, lw_flux_dn_ref );
 
-        // Load ad parameter list
-        std::string fname = "input.yaml";
+        // Load ad parameter list (the same test runs with different configurations, e.g. column blocking)
+        const auto& test_params = ekat::TestSession::get().params;
+        std::string fname = test_params.count("rrtmgp_input_yaml")>0 ? test_params.at("rrtmgp_input_yaml") : "input.yaml";
         ekat::ParameterList ad_params("Atmosphere Driver");
         REQUIRE_NOTHROW ( parse_yaml_file(fname,ad_params) );
         // Create a MPI communicator
@@ -10,6 +10,7 @@
 
 #include "ekat/ekat_pack.hpp"
 #include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
 
 namespace scream {
 
@@ -21,8 +22,9 @@ TEST_CASE("shoc-stand-alone", "") {
 
   constexpr int num_iters = 10;
 
-  // Load ad parameter list
-  std::string fname = "input.yaml";
+  // Load ad parameter list (the same test runs with different configurations, e.g. subcycling)
+  const auto& test_params = ekat::TestSession::get().params;
+  std::string fname = test_params.count("shoc_input_yaml")>0 ? test_params.at("shoc_input_yaml") : "input.yaml";
   ekat::ParameterList ad_params("Atmosphere Driver");
   REQUIRE_NOTHROW ( parse_yaml_file(fname,ad_params) );
 